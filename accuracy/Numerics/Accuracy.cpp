@@ -0,0 +1,276 @@
+//
+//  Accuracy.cpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Measurement.hpp"
+
+#include <Numerics/Trigonometry.hpp>
+#include <Numerics/Number.hpp>
+#include <Numerics/Vector.hpp>
+#include <Numerics/Quaternion.hpp>
+#include <Numerics/Quaternion/Interpolate.hpp>
+#include <Numerics/Matrix.hpp>
+#include <Numerics/Matrix/Inverse.hpp>
+
+#include <iostream>
+#include <random>
+#include <vector>
+#include <cstdlib>
+
+// Measures the error of the exact and fast kernels over their input domains, and writes one line of JSON per measurement. The optional argument is the number of samples in each measurement.
+
+namespace Numerics
+{
+	namespace Accuracy
+	{
+		namespace
+		{
+			template <typename FloatT>
+			const char * name();
+
+			template <> const char * name<float>() { return "float"; }
+			template <> const char * name<double>() { return "double"; }
+
+			const char * name(Precision precision) { return precision == FAST ? "fast" : "exact"; }
+
+			std::string label(const char * function, Precision precision)
+			{
+				return std::string(function) + " (" + name(precision) + ")";
+			}
+
+			template <typename FloatT>
+			std::vector<FloatT> uniform(FloatT minimum, FloatT maximum, std::size_t count)
+			{
+				std::mt19937_64 random(count);
+				std::uniform_real_distribution<long double> distribution(minimum, maximum);
+
+				std::vector<FloatT> values(count);
+
+				for (auto & value : values)
+					value = static_cast<FloatT>(distribution(random));
+
+				return values;
+			}
+
+			/// Uniformly distributed exponents, for functions which are scale invariant.
+			template <typename FloatT>
+			std::vector<FloatT> logarithmic(FloatT minimum, FloatT maximum, std::size_t count)
+			{
+				auto exponents = uniform<long double>(std::log2((long double)minimum), std::log2((long double)maximum), count);
+
+				std::vector<FloatT> values(count);
+
+				for (std::size_t i = 0; i < count; i += 1)
+					values[i] = static_cast<FloatT>(std::exp2(exponents[i]));
+
+				return values;
+			}
+
+			template <typename FloatT, Precision PRECISION>
+			void sine_cosine(std::ostream & output, std::size_t count, FloatT minimum, FloatT maximum)
+			{
+				Measurement sine(label("sin", PRECISION), name<FloatT>(), minimum, maximum);
+				Measurement cosine(label("cos", PRECISION), name<FloatT>(), minimum, maximum);
+
+				for (FloatT x : uniform(minimum, maximum, count)) {
+					FloatT s, c;
+					Trigonometry::sin_cos<PRECISION>(x, s, c);
+
+					sine.add(s, std::sin((long double)x), x);
+					cosine.add(c, std::cos((long double)x), x);
+				}
+
+				sine.write(output);
+				cosine.write(output);
+			}
+
+			/// The array functions, which use SIMD where available.
+			void sine_cosine_arrays(std::ostream & output, std::size_t count, float minimum, float maximum)
+			{
+				Measurement sine("sin (array)", "float", minimum, maximum);
+				Measurement cosine("cos (array)", "float", minimum, maximum);
+
+				auto xs = uniform(minimum, maximum, count);
+				std::vector<float> ss(count), cs(count);
+
+				Trigonometry::sin_cos(xs.data(), ss.data(), cs.data(), count);
+
+				for (std::size_t i = 0; i < count; i += 1) {
+					sine.add(ss[i], std::sin((long double)xs[i]), xs[i]);
+					cosine.add(cs[i], std::cos((long double)xs[i]), xs[i]);
+				}
+
+				sine.write(output);
+				cosine.write(output);
+			}
+
+			template <typename FloatT, Precision PRECISION>
+			void arc_cosine(std::ostream & output, std::size_t count)
+			{
+				Measurement measurement(label("acos", PRECISION), name<FloatT>(), -1, 1);
+
+				for (FloatT x : uniform<FloatT>(-1, 1, count))
+					measurement.add(Trigonometry::acos<PRECISION>(x), std::acos((long double)x), x);
+
+				measurement.write(output);
+			}
+
+			template <typename FloatT, Precision PRECISION>
+			void square_roots(std::ostream & output, std::size_t count)
+			{
+				const FloatT MINIMUM = 1e-6, MAXIMUM = 1e6;
+
+				Measurement reciprocal(label("rsqrt", PRECISION), name<FloatT>(), MINIMUM, MAXIMUM);
+				Measurement root(label("sqrt", PRECISION), name<FloatT>(), MINIMUM, MAXIMUM);
+
+				for (FloatT x : logarithmic(MINIMUM, MAXIMUM, count)) {
+					FloatT r = reciprocal_square_root<PRECISION>(x);
+
+					reciprocal.add(r, 1 / std::sqrt((long double)x), x);
+
+					// The square root as computed by Vector::length:
+					root.add(PRECISION == FAST ? x * r : std::sqrt(x), std::sqrt((long double)x), x);
+				}
+
+				reciprocal.write(output);
+				root.write(output);
+			}
+
+			/// The error of each component, with the input being the first component.
+			template <typename FloatT, Precision PRECISION>
+			void normalize(std::ostream & output, std::size_t count)
+			{
+				Measurement measurement(label("normalize", PRECISION), name<FloatT>(), -10, 10);
+
+				auto values = uniform<FloatT>(-10, 10, count * 3);
+
+				for (std::size_t i = 0; i < count; i += 1) {
+					Vector<3, FloatT> v = {values[i*3], values[i*3+1], values[i*3+2]};
+					auto n = v.template normalize<PRECISION>();
+
+					long double length = std::sqrt((long double)v[0] * v[0] + (long double)v[1] * v[1] + (long double)v[2] * v[2]);
+
+					for (std::size_t j = 0; j < 3; j += 1)
+						measurement.add(n[j], v[j] / length, v[0]);
+				}
+
+				measurement.write(output);
+			}
+
+			/// Spherical linear interpolation between random rotations, taking the shorter path. The fast interpolation isn't renormalized, so its error is relative to the exact interpolation rather than a unit quaternion. The input is t.
+			template <typename FloatT, Precision PRECISION>
+			void spherical_linear(std::ostream & output, std::size_t count)
+			{
+				Measurement measurement(label("slerp", PRECISION), name<FloatT>(), 0, 1);
+
+				auto components = uniform<FloatT>(-1, 1, count * 8);
+				auto ts = uniform<FloatT>(0, 1, count);
+
+				for (std::size_t i = 0; i < count; i += 1) {
+					Vector<4, FloatT> a = {components[i*8], components[i*8+1], components[i*8+2], components[i*8+3]};
+					Vector<4, FloatT> b = {components[i*8+4], components[i*8+5], components[i*8+6], components[i*8+7]};
+
+					Quaternion<FloatT> q0(a.normalize()), q1(b.normalize());
+					FloatT t = ts[i];
+
+					Quaternion<FloatT> q;
+
+					if (PRECISION == FAST) {
+						q = Interpolate::fast_spherical_linear(t, q0, q1);
+					} else {
+						// The scalar interpolation doesn't take the shorter path:
+						if (q0.dot(q1) < 0) q1 = Quaternion<FloatT>(-static_cast<const Vector<4, FloatT> &>(q1));
+
+						q = Interpolate::spherical_linear(t, q0, q1);
+					}
+
+					long double dot = 0;
+					for (std::size_t j = 0; j < 4; j += 1) dot += (long double)q0[j] * q1[j];
+
+					long double sign = dot < 0 ? -1 : 1, theta = std::acos(std::min<long double>(dot * sign, 1)), sin_theta = std::sin(theta);
+					long double wa = sin_theta > 0 ? std::sin((1 - t) * theta) / sin_theta : 1 - t;
+					long double wb = sin_theta > 0 ? std::sin(t * theta) / sin_theta : t;
+
+					for (std::size_t j = 0; j < 4; j += 1)
+						measurement.add(q[j], wa * q0[j] + wb * sign * q1[j], t);
+				}
+
+				measurement.write(output);
+			}
+
+			/// Inverse of well conditioned matrices, i.e. diagonally dominant, compared with the inverse computed in extended precision. The input is the first element.
+			template <typename FloatT>
+			void inverse(std::ostream & output, std::size_t count)
+			{
+				Measurement measurement("inverse (exact)", name<FloatT>(), -1, 1);
+
+				auto values = uniform<FloatT>(-1, 1, count * 16);
+
+				for (std::size_t i = 0; i < count; i += 1) {
+					Matrix<4, 4, FloatT> m;
+					Matrix<4, 4, long double> reference;
+
+					for (std::size_t j = 0; j < 16; j += 1) {
+						m[j] = values[i*16 + j] + ((j % 5 == 0) ? 4 : 0);
+						reference[j] = m[j];
+					}
+
+					auto result = Numerics::inverse(m);
+					auto expected = Numerics::inverse(reference);
+
+					for (std::size_t j = 0; j < 16; j += 1)
+						measurement.add(result[j], expected[j], m[0]);
+				}
+
+				measurement.write(output);
+			}
+		}
+
+		void run(std::ostream & output, std::size_t count)
+		{
+			const float PI = M_PI;
+
+			sine_cosine<float, EXACT>(output, count, -PI, PI);
+			sine_cosine<float, EXACT>(output, count, -100, 100);
+			sine_cosine<double, EXACT>(output, count, -M_PI, M_PI);
+			sine_cosine<double, EXACT>(output, count, -100, 100);
+			sine_cosine<double, FAST>(output, count, -M_PI, M_PI);
+			sine_cosine_arrays(output, count, -100, 100);
+
+			arc_cosine<float, EXACT>(output, count);
+			arc_cosine<double, EXACT>(output, count);
+			arc_cosine<double, FAST>(output, count);
+
+			square_roots<float, EXACT>(output, count);
+			square_roots<float, FAST>(output, count);
+			square_roots<double, EXACT>(output, count);
+			square_roots<double, FAST>(output, count);
+
+			normalize<float, EXACT>(output, count);
+			normalize<float, FAST>(output, count);
+			normalize<double, EXACT>(output, count);
+			normalize<double, FAST>(output, count);
+
+			spherical_linear<float, EXACT>(output, count);
+			spherical_linear<float, FAST>(output, count);
+			spherical_linear<double, EXACT>(output, count);
+			spherical_linear<double, FAST>(output, count);
+
+			inverse<float>(output, count);
+			inverse<double>(output, count);
+		}
+	}
+}
+
+int main(int argc, char ** argv)
+{
+	std::size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+
+	Numerics::Accuracy::run(std::cout, count);
+
+	return 0;
+}
@@ -0,0 +1,39 @@
+//
+//  Measurement.cpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Measurement.hpp"
+
+namespace Numerics
+{
+	namespace Accuracy
+	{
+		void Measurement::write(std::ostream & output) const
+		{
+			std::size_t last = _histogram.size();
+			while (last > 1 && _histogram[last-1] == 0) last -= 1;
+
+			auto precision = output.precision(17);
+
+			output << "{\"name\": \"" << _name << "\", \"type\": \"" << _type << "\"";
+			output << ", \"domain\": [" << double(_minimum) << ", " << double(_maximum) << "]";
+			output << ", \"samples\": " << _samples;
+			output << ", \"maximum_ulp\": " << _maximum_distance;
+			output << ", \"mean_ulp\": " << mean_distance();
+			output << ", \"maximum_absolute\": " << double(_maximum_absolute);
+			output << ", \"worst_input\": " << double(_worst_input);
+			output << ", \"histogram\": [";
+
+			for (std::size_t k = 0; k < last; k += 1)
+				output << (k ? ", " : "") << _histogram[k];
+
+			output << "]}" << std::endl;
+
+			output.precision(precision);
+		}
+	}
+}
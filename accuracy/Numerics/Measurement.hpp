@@ -0,0 +1,87 @@
+//
+//  Measurement.hpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include <Numerics/Float.hpp>
+
+#include <array>
+#include <string>
+#include <ostream>
+#include <cstdint>
+#include <limits>
+#include <cmath>
+
+namespace Numerics
+{
+	namespace Accuracy
+	{
+		/// The error of a function over a domain, in units in the last place of the result type, compared with a reference computed in higher precision.
+		class Measurement
+		{
+		public:
+			/// Bucket 0 counts exact results, and bucket k counts errors in [2^(k-1), 2^k).
+			typedef std::array<std::size_t, 65> HistogramT;
+
+			Measurement(std::string name, std::string type, long double minimum, long double maximum) : _name(std::move(name)), _type(std::move(type)), _minimum(minimum), _maximum(maximum) {}
+
+			/// Add a result, and the reference value for the same input, which is rounded to the type of the result before comparing. A NaN result has the largest possible error unless the reference is also NaN.
+			template <typename FloatT>
+			void add(const FloatT & result, const long double & reference, const long double & input)
+			{
+				FloatT rounded = static_cast<FloatT>(reference);
+				std::uint64_t distance;
+
+				if (std::isnan(result) || std::isnan(rounded))
+					distance = (std::isnan(result) && std::isnan(rounded)) ? 0 : std::numeric_limits<std::uint64_t>::max();
+				else
+					distance = FloatEquivalenceTraits<FloatT>::integral_difference(result, rounded);
+
+				_samples += 1;
+				_sum += distance;
+				_histogram[bucket(distance)] += 1;
+
+				if (distance > _maximum_distance || _samples == 1) {
+					_maximum_distance = distance;
+					_worst_input = input;
+				}
+
+				long double absolute = std::abs(result - reference);
+				if (absolute > _maximum_absolute) _maximum_absolute = absolute;
+			}
+
+			std::size_t samples() const { return _samples; }
+			std::uint64_t maximum_distance() const { return _maximum_distance; }
+			double mean_distance() const { return _samples ? double(_sum / _samples) : 0; }
+
+			/// Write the measurement as a single line of JSON. The histogram is truncated after the last non-empty bucket.
+			void write(std::ostream & output) const;
+
+		private:
+			std::string _name, _type;
+			long double _minimum, _maximum;
+
+			std::size_t _samples = 0;
+			long double _sum = 0;
+			std::uint64_t _maximum_distance = 0;
+			long double _worst_input = 0, _maximum_absolute = 0;
+
+			HistogramT _histogram = {};
+
+			static std::size_t bucket(std::uint64_t distance)
+			{
+				std::size_t k = 0;
+
+				for (; distance; distance >>= 1)
+					k += 1;
+
+				return k;
+			}
+		};
+	}
+}
@@ -0,0 +1,18 @@
+//
+//  Animation.cpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Animation.hpp"
+
+namespace Numerics
+{
+	namespace Animation
+	{
+		template class Track<float>;
+		template class Track<double>;
+	}
+}
@@ -0,0 +1,226 @@
+//
+//  Animation.hpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "Interpolate.hpp"
+#include "Vector.hpp"
+#include "Quaternion.hpp"
+#include "Quaternion/Interpolate.hpp"
+
+#include "Animation/SSE.hpp"
+
+#include <vector>
+#include <algorithm>
+#include <cassert>
+
+namespace Numerics
+{
+	namespace Animation
+	{
+		/// Linearly interpolate between two rows of keyframe values. This is specialized where SIMD is available.
+		template <typename NumericT>
+		inline void linear(std::size_t count, const NumericT & t, const NumericT * a, const NumericT * b, NumericT * result)
+		{
+			for (std::size_t i = 0; i < count; i += 1)
+				result[i] = Interpolate::linear(t, a[i], b[i]);
+		}
+
+		/// How the keys of a track are interpolated.
+		enum Interpolation {STEP, LINEAR};
+
+		/// How a channel is blended between keys. Rotation channels are four components wide, and take the shorter path.
+		enum Blend {
+			/// Scalars and vectors.
+			COMPONENTS,
+			/// Rotations, using linear interpolation followed by normalization.
+			NORMALIZED_LINEAR,
+			/// Rotations, using approximate spherical linear interpolation.
+			SPHERICAL_LINEAR
+		};
+
+		/// The key a track was last sampled at, so that sequential playback doesn't need to search. Each playing instance of a track has its own cursor.
+		struct Cursor
+		{
+			std::size_t key = 0;
+		};
+
+		/// A track of keyframes, each with the same channels. Key times are stored separately from the values, and the values of each key are stored contiguously as a row of scalars, so that every channel is interpolated together.
+		template <typename NumericT = RealT>
+		class Track
+		{
+		public:
+			struct Channel
+			{
+				std::size_t offset, width;
+				Blend blend;
+			};
+
+			Track(Interpolation interpolation = LINEAR) : _interpolation(interpolation) {}
+
+			Interpolation interpolation() const { return _interpolation; }
+
+			/// The number of scalars in each key.
+			std::size_t width() const { return _width; }
+
+			std::size_t size() const { return _times.size(); }
+
+			const std::vector<Channel> & channels() const { return _channels; }
+
+			NumericT start() const { return _times.front(); }
+			NumericT end() const { return _times.back(); }
+
+			/// Add a channel of the given width, returning its offset within each key. Channels must be added before keys.
+			std::size_t add_channel(std::size_t width, Blend blend = COMPONENTS)
+			{
+				assert(_times.empty());
+				assert(blend == COMPONENTS || width == 4);
+
+				std::size_t offset = _width;
+
+				_channels.push_back({offset, width, blend});
+				_width += width;
+
+				return offset;
+			}
+
+			/// Add a key at the given time, which must not be before the previous key. Returns the values of the key, which are initially zero.
+			NumericT * add_key(const NumericT & time)
+			{
+				assert(_times.empty() || time >= _times.back());
+
+				_times.push_back(time);
+				_values.resize(_values.size() + _width, 0);
+
+				return key(_times.size() - 1);
+			}
+
+			NumericT * key(std::size_t index) { return _values.data() + index * _width; }
+			const NumericT * key(std::size_t index) const { return _values.data() + index * _width; }
+
+			NumericT time(std::size_t index) const { return _times[index]; }
+
+			template <std::size_t N>
+			void set(std::size_t index, std::size_t offset, const Vector<N, NumericT> & value)
+			{
+				std::copy(value.begin(), value.end(), key(index) + offset);
+			}
+
+			/// Find the key at the start of the segment containing time, i.e. times[k] <= time < times[k+1], clamped to the first and last segments. Sequential playback either stays in the same segment or moves to the next one, which is checked before searching.
+			std::size_t find(const NumericT & time, Cursor & cursor) const
+			{
+				std::size_t count = _times.size(), k = cursor.key;
+
+				if (count < 2) return 0;
+
+				if (k + 1 < count && _times[k] <= time) {
+					if (time < _times[k+1] || k + 2 == count) return k;
+
+					if (k + 2 < count && time < _times[k+2]) return cursor.key = k + 1;
+				}
+
+				// The first and last keys are excluded from the search, so that the result is clamped:
+				auto next = std::upper_bound(_times.begin() + 1, _times.end() - 1, time);
+
+				return cursor.key = (next - _times.begin()) - 1;
+			}
+
+			/// Sample every channel at the given time, writing width() values to result. Times outside the track are clamped to the first and last keys.
+			void sample(const NumericT & time, Cursor & cursor, NumericT * result) const
+			{
+				assert(!_times.empty());
+
+				std::size_t k = find(time, cursor);
+
+				if (_times.size() == 1) {
+					std::copy(key(0), key(0) + _width, result);
+					return;
+				}
+
+				NumericT t0 = _times[k], t1 = _times[k+1];
+				NumericT t = t1 > t0 ? (time - t0) / (t1 - t0) : 1;
+				t = std::max<NumericT>(0, std::min<NumericT>(t, 1));
+
+				if (_interpolation == STEP) {
+					const NumericT * row = key(t < 1 ? k : k + 1);
+					std::copy(row, row + _width, result);
+					return;
+				}
+
+				const NumericT * a = key(k), * b = key(k+1);
+
+				Animation::linear(_width, t, a, b, result);
+
+				for (const auto & channel : _channels) {
+					if (channel.blend != COMPONENTS)
+						rotation(channel, t, a + channel.offset, b + channel.offset, result + channel.offset);
+				}
+			}
+
+			/// Sample a batch of instances of this track, each with its own time and cursor. Results are written as consecutive rows of width() values.
+			void sample(std::size_t count, const NumericT * times, Cursor * cursors, NumericT * results) const
+			{
+				for (std::size_t i = 0; i < count; i += 1)
+					sample(times[i], cursors[i], results + i * _width);
+			}
+
+			template <std::size_t N>
+			static Vector<N, NumericT> vector(const NumericT * values, std::size_t offset)
+			{
+				Vector<N, NumericT> result(ZERO);
+				std::copy(values + offset, values + offset + N, result.begin());
+
+				return result;
+			}
+
+			static Quaternion<NumericT> quaternion(const NumericT * values, std::size_t offset)
+			{
+				return Quaternion<NumericT>(vector<4>(values, offset));
+			}
+
+		private:
+			Interpolation _interpolation;
+
+			std::size_t _width = 0;
+			std::vector<Channel> _channels;
+
+			std::vector<NumericT> _times;
+			std::vector<NumericT> _values;
+
+			// The result already holds the linear interpolation of the components, which is correct unless the rotations are more than 90 degrees apart:
+			static void rotation(const Channel & channel, const NumericT & t, const NumericT * a, const NumericT * b, NumericT * result)
+			{
+				Quaternion<NumericT> q0 = quaternion(a, 0), q1 = quaternion(b, 0), q;
+
+				if (channel.blend == SPHERICAL_LINEAR) {
+					q = Interpolate::fast_spherical_linear(t, q0, q1);
+				} else {
+					if (q0.dot(q1) < 0)
+						q = Quaternion<NumericT>(Interpolate::linear(t, static_cast<const Vector<4, NumericT> &>(q0), -static_cast<const Vector<4, NumericT> &>(q1)));
+					else
+						q = quaternion(result, 0);
+				}
+
+				const Vector<4, NumericT> & v = q;
+				auto n = v.normalize();
+				std::copy(n.begin(), n.end(), result);
+			}
+		};
+
+		/// Sample many tracks, each at its own time with its own cursor, e.g. the clips of a crowd. Results are written to the corresponding row pointers.
+		template <typename NumericT>
+		void sample(std::size_t count, const Track<NumericT> * const * tracks, const NumericT * times, Cursor * cursors, NumericT * const * results)
+		{
+			for (std::size_t i = 0; i < count; i += 1)
+				tracks[i]->sample(times[i], cursors[i], results[i]);
+		}
+
+		extern template class Track<float>;
+		extern template class Track<double>;
+	}
+}
@@ -0,0 +1,39 @@
+//
+//  SSE.cpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "SSE.hpp"
+
+#ifdef NUMERICS_ANIMATION_SSE
+
+#include <xmmintrin.h>
+
+namespace Numerics
+{
+	namespace Animation
+	{
+		void linear(std::size_t count, float t, const float * a, const float * b, float * result)
+		{
+			const float s = 1 - t;
+			const __m128 ts = _mm_set1_ps(t), ss = _mm_set1_ps(s);
+
+			std::size_t i = 0;
+
+			for (; i + 4 <= count; i += 4) {
+				__m128 ai = _mm_loadu_ps(a + i), bi = _mm_loadu_ps(b + i);
+
+				_mm_storeu_ps(result + i, _mm_add_ps(_mm_mul_ps(ai, ss), _mm_mul_ps(bi, ts)));
+			}
+
+			for (; i < count; i += 1) {
+				result[i] = a[i] * s + b[i] * t;
+			}
+		}
+	}
+}
+
+#endif
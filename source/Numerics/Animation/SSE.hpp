@@ -0,0 +1,26 @@
+//
+//  SSE.hpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#ifdef __SSE2__
+
+#define NUMERICS_ANIMATION_SSE
+
+#include <cstddef>
+
+namespace Numerics
+{
+	namespace Animation
+	{
+		// Linearly interpolate between two rows of keyframe values, four at a time:
+		void linear(std::size_t count, float t, const float * a, const float * b, float * result);
+	}
+}
+
+#endif
@@ -0,0 +1,15 @@
+//
+//  BlockSparseMatrix.cpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "BlockSparseMatrix.hpp"
+
+namespace Numerics
+{
+	template class BlockSparseMatrix<3, 3, float>;
+	template class BlockSparseMatrix<3, 3, double>;
+}
@@ -0,0 +1,146 @@
+//
+//  BlockSparseMatrix.hpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "SparseMatrix.hpp"
+
+namespace Numerics
+{
+	/// Accumulate a row of blocks, each multiplied by the vector selected by its column index: result += sum(blocks[k] * right[indices[k]]).
+	template <std::size_t R, std::size_t C, typename NumericT, typename IndexT>
+	void multiply(Vector<R, NumericT> & result, const Matrix<R, C, NumericT> * blocks, const IndexT * indices, std::size_t count, const Vector<C, NumericT> * right)
+	{
+		for (std::size_t k = 0; k < count; k += 1)
+			multiply(result, blocks[k], right[indices[k]]);
+	}
+
+	/// A sparse matrix in block compressed sparse row (BSR) format, where every stored entry is a dense R x C block.
+	/// It multiplies arrays of Vector<C> (one per block column) to produce arrays of Vector<R> (one per block row).
+	template <std::size_t R, std::size_t C, typename NumericT = RealT>
+	class BlockSparseMatrix
+	{
+	public:
+		typedef Sparse::IndexT IndexT;
+		typedef Matrix<R, C, NumericT> BlockT;
+
+		BlockSparseMatrix() : _offsets(1, 0) {}
+
+		/// An empty matrix with the given number of block rows and block columns.
+		BlockSparseMatrix(std::size_t rows, std::size_t columns) : _rows(rows), _columns(columns), _offsets(rows + 1, 0) {}
+
+		/// Assemble a matrix from block triplets, indexed by block row and block column. Duplicate blocks are summed.
+		BlockSparseMatrix(std::size_t rows, std::size_t columns, const std::vector<Triplet<BlockT>> & triplets) : _rows(rows), _columns(columns)
+		{
+			Sparse::assemble(rows, columns, triplets.data(), triplets.size(), _offsets, _indices, _blocks);
+		}
+
+		/// The number of block rows.
+		std::size_t rows() const {return _rows;}
+
+		/// The number of block columns.
+		std::size_t columns() const {return _columns;}
+
+		/// The number of stored blocks.
+		std::size_t non_zeros() const {return _indices.size();}
+
+		const std::vector<std::size_t> & offsets() const {return _offsets;}
+		const std::vector<IndexT> & indices() const {return _indices;}
+		const Sparse::StorageT<BlockT> & blocks() const {return _blocks;}
+		Sparse::StorageT<BlockT> & blocks() {return _blocks;}
+
+		/// Look up a single block. Blocks which are not stored are zero.
+		BlockT at(std::size_t r, std::size_t c) const
+		{
+			assert(r < _rows && c < _columns);
+
+			auto begin = _indices.begin() + _offsets[r], end = _indices.begin() + _offsets[r + 1];
+			auto i = std::lower_bound(begin, end, c);
+
+			if (i != end && *i == c)
+				return _blocks[i - _indices.begin()];
+
+			return BlockT(ZERO);
+		}
+
+		/// Expand into a scalar sparse matrix.
+		SparseMatrix<NumericT> scalar() const
+		{
+			std::vector<Triplet<NumericT>> triplets;
+			triplets.reserve(non_zeros() * R * C);
+
+			for (std::size_t r = 0; r < _rows; r += 1)
+				for (std::size_t k = _offsets[r]; k < _offsets[r + 1]; k += 1)
+					for (std::size_t j = 0; j < C; j += 1)
+						for (std::size_t i = 0; i < R; i += 1)
+							triplets.push_back({r * R + i, _indices[k] * C + j, _blocks[k].at(i, j)});
+
+			return SparseMatrix<NumericT>(_rows * R, _columns * C, triplets);
+		}
+
+	private:
+		std::size_t _rows = 0, _columns = 0;
+
+		std::vector<std::size_t> _offsets;
+		std::vector<IndexT> _indices;
+		Sparse::StorageT<BlockT> _blocks;
+	};
+
+	/// Block sparse matrix-vector multiply for block rows [begin, end): result += left * right.
+	template <std::size_t R, std::size_t C, typename NumericT>
+	void multiply(Vector<R, NumericT> * result, const BlockSparseMatrix<R, C, NumericT> & left, const Vector<C, NumericT> * right, std::size_t begin, std::size_t end)
+	{
+		const auto & offsets = left.offsets();
+		const auto * indices = left.indices().data();
+		const auto * blocks = left.blocks().data();
+
+		for (std::size_t r = begin; r < end; r += 1)
+			multiply(result[r], blocks + offsets[r], indices + offsets[r], offsets[r + 1] - offsets[r], right);
+	}
+
+	/// Transposed block sparse matrix-vector multiply for block rows [begin, end) of left: result += transpose(left) * right.
+	template <std::size_t R, std::size_t C, typename NumericT>
+	void multiply_transpose(Vector<C, NumericT> * result, const BlockSparseMatrix<R, C, NumericT> & left, const Vector<R, NumericT> * right, std::size_t begin, std::size_t end)
+	{
+		const auto & offsets = left.offsets();
+		const auto * indices = left.indices().data();
+		const auto * blocks = left.blocks().data();
+
+		for (std::size_t r = begin; r < end; r += 1) {
+			const auto & x = right[r];
+
+			for (std::size_t k = offsets[r]; k < offsets[r + 1]; k += 1) {
+				auto & y = result[indices[k]];
+				const auto & block = blocks[k];
+
+				for (std::size_t c = 0; c < C; c += 1)
+					for (std::size_t i = 0; i < R; i += 1)
+						y[c] += block.at(i, c) * x[i];
+			}
+		}
+	}
+
+	template <std::size_t R, std::size_t C, typename NumericT>
+	void multiply(std::vector<Vector<R, NumericT>> & result, const BlockSparseMatrix<R, C, NumericT> & left, const std::vector<Vector<C, NumericT>> & right)
+	{
+		assert(left.rows() == result.size() && left.columns() == right.size());
+
+		multiply(result.data(), left, right.data(), 0, left.rows());
+	}
+
+	template <std::size_t R, std::size_t C, typename NumericT>
+	void multiply_transpose(std::vector<Vector<C, NumericT>> & result, const BlockSparseMatrix<R, C, NumericT> & left, const std::vector<Vector<R, NumericT>> & right)
+	{
+		assert(left.columns() == result.size() && left.rows() == right.size());
+
+		multiply_transpose(result.data(), left, right.data(), 0, left.rows());
+	}
+
+	extern template class BlockSparseMatrix<3, 3, float>;
+	extern template class BlockSparseMatrix<3, 3, double>;
+}
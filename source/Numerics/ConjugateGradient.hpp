@@ -0,0 +1,241 @@
+//
+//  ConjugateGradient.hpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "BlockSparseMatrix.hpp"
+#include "Parallel.hpp"
+
+namespace Numerics
+{
+	/// Leaves the residual unchanged, giving the standard conjugate gradient method.
+	template <std::size_t D, typename NumericT>
+	struct IdentityPreconditioner
+	{
+		IdentityPreconditioner(const BlockSparseMatrix<D, D, NumericT> &) {}
+
+		void apply(Vector<D, NumericT> & z, const Vector<D, NumericT> & r, std::size_t) const
+		{
+			z = r;
+		}
+	};
+
+	/// Scales the residual by the inverse of the diagonal of the matrix.
+	template <std::size_t D, typename NumericT>
+	struct JacobiPreconditioner
+	{
+		std::vector<Vector<D, NumericT>> inverse_diagonal;
+
+		JacobiPreconditioner(const BlockSparseMatrix<D, D, NumericT> & matrix) : inverse_diagonal(matrix.rows())
+		{
+			for (std::size_t i = 0; i < matrix.rows(); i += 1) {
+				auto block = matrix.at(i, i);
+
+				for (std::size_t j = 0; j < D; j += 1)
+					inverse_diagonal[i][j] = block.at(j, j) != 0 ? NumericT(1) / block.at(j, j) : NumericT(1);
+			}
+		}
+
+		void apply(Vector<D, NumericT> & z, const Vector<D, NumericT> & r, std::size_t i) const
+		{
+			z = r * inverse_diagonal[i];
+		}
+	};
+
+	/// Multiplies the residual by the inverse of the diagonal blocks of the matrix, which captures the coupling within each block.
+	template <std::size_t D, typename NumericT>
+	struct BlockJacobiPreconditioner
+	{
+		Sparse::StorageT<Matrix<D, D, NumericT>> inverse_diagonal;
+
+		BlockJacobiPreconditioner(const BlockSparseMatrix<D, D, NumericT> & matrix) : inverse_diagonal(matrix.rows())
+		{
+			for (std::size_t i = 0; i < matrix.rows(); i += 1)
+				inverse_diagonal[i] = inverse(matrix.at(i, i));
+		}
+
+		void apply(Vector<D, NumericT> & z, const Vector<D, NumericT> & r, std::size_t i) const
+		{
+			z = ZERO;
+
+			multiply(z, inverse_diagonal[i], r);
+		}
+	};
+
+	/// Solves A x = b for a symmetric positive definite block sparse matrix A, using the preconditioned conjugate gradient method.
+	/// Each iteration makes three passes over the vectors: q = A p fused with p.q; x += alpha p, r -= alpha q and z = M r fused with r.z and r.r; and p = z + beta p.
+	template <std::size_t D, typename NumericT, typename PreconditionerT = JacobiPreconditioner<D, NumericT>>
+	class ConjugateGradient
+	{
+	public:
+		typedef Vector<D, NumericT> VectorT;
+
+		struct Result
+		{
+			std::size_t iterations;
+
+			/// The final residual norm, relative to the norm of b.
+			NumericT residual;
+
+			bool converged;
+		};
+
+		/// Stop once |r| <= tolerance * |b|.
+		NumericT tolerance = 1e-6;
+
+		std::size_t maximum_iterations = 1000;
+
+		/// The number of block rows processed by a single task.
+		std::size_t grain = 1024;
+
+		ConjugateGradient(const BlockSparseMatrix<D, D, NumericT> & matrix, Parallel::Executor & executor = Parallel::default_executor()) : _matrix(matrix), _preconditioner(matrix), _executor(executor)
+		{
+			assert(matrix.rows() == matrix.columns());
+		}
+
+		ConjugateGradient(const BlockSparseMatrix<D, D, NumericT> & matrix, const PreconditionerT & preconditioner, Parallel::Executor & executor = Parallel::default_executor()) : _matrix(matrix), _preconditioner(preconditioner), _executor(executor)
+		{
+			assert(matrix.rows() == matrix.columns());
+		}
+
+		const PreconditionerT & preconditioner() const {return _preconditioner;}
+
+		/// Solve for x, using its current value as the initial guess.
+		Result solve(std::vector<VectorT> & x, const std::vector<VectorT> & b)
+		{
+			std::size_t size = _matrix.rows();
+
+			assert(x.size() == size && b.size() == size);
+
+			_r.resize(size);
+			_z.resize(size);
+			_p.resize(size);
+			_q.resize(size);
+
+			// r = b - A x, z = M r:
+			auto initial = sum<3>([&](std::size_t begin, std::size_t end) {
+				Vector<3, NumericT> partial(ZERO);
+
+				for (std::size_t i = begin; i < end; i += 1) {
+					_r[i] = b[i] - row(i, x.data());
+					_preconditioner.apply(_z[i], _r[i], i);
+					_p[i] = _z[i];
+
+					partial[0] += _r[i].dot(_z[i]);
+					partial[1] += _r[i].length_squared();
+					partial[2] += b[i].length_squared();
+				}
+
+				return partial;
+			});
+
+			NumericT rz = initial[0], rr = initial[1], bb = initial[2];
+
+			if (bb == 0) {
+				std::fill(x.begin(), x.end(), VectorT(ZERO));
+
+				return {0, 0, true};
+			}
+
+			NumericT threshold = tolerance * tolerance * bb;
+			Result result{0, std::sqrt(rr / bb), false};
+
+			while (true) {
+				if (rr <= threshold) {
+					result.converged = true;
+					break;
+				}
+
+				if (result.iterations == maximum_iterations) break;
+
+				// q = A p:
+				NumericT pq = sum<1>([&](std::size_t begin, std::size_t end) {
+					Vector<1, NumericT> partial(ZERO);
+
+					for (std::size_t i = begin; i < end; i += 1) {
+						_q[i] = row(i, _p.data());
+						partial[0] += _p[i].dot(_q[i]);
+					}
+
+					return partial;
+				})[0];
+
+				// The matrix is not positive definite:
+				if (pq <= 0) break;
+
+				NumericT alpha = rz / pq;
+
+				auto update = sum<2>([&](std::size_t begin, std::size_t end) {
+					Vector<2, NumericT> partial(ZERO);
+
+					for (std::size_t i = begin; i < end; i += 1) {
+						x[i] += _p[i] * alpha;
+						_r[i] -= _q[i] * alpha;
+						_preconditioner.apply(_z[i], _r[i], i);
+
+						partial[0] += _r[i].dot(_z[i]);
+						partial[1] += _r[i].length_squared();
+					}
+
+					return partial;
+				});
+
+				NumericT beta = update[0] / rz;
+				rz = update[0];
+				rr = update[1];
+
+				Parallel::parallel_for(0, size, grain, [&](std::size_t begin, std::size_t end) {
+					for (std::size_t i = begin; i < end; i += 1)
+						_p[i] = _z[i] + _p[i] * beta;
+				}, _executor);
+
+				result.iterations += 1;
+				result.residual = std::sqrt(rr / bb);
+			}
+
+			return result;
+		}
+
+	private:
+		const BlockSparseMatrix<D, D, NumericT> & _matrix;
+		PreconditionerT _preconditioner;
+		Parallel::Executor & _executor;
+
+		std::vector<VectorT> _r, _z, _p, _q;
+
+		/// Multiply a single block row of the matrix.
+		VectorT row(std::size_t i, const VectorT * right) const
+		{
+			const auto & offsets = _matrix.offsets();
+			VectorT result(ZERO);
+
+			multiply(result, _matrix.blocks().data() + offsets[i], _matrix.indices().data() + offsets[i], offsets[i + 1] - offsets[i], right);
+
+			return result;
+		}
+
+		/// Run function over each grain of rows and sum the partial results in order, so that the result doesn't depend on the executor.
+		template <std::size_t N, typename FunctionT>
+		Vector<N, NumericT> sum(const FunctionT & function)
+		{
+			std::size_t size = _matrix.rows();
+			std::vector<Vector<N, NumericT>> partials((size + grain - 1) / grain, Vector<N, NumericT>(ZERO));
+
+			_executor.run(partials.size(), [&](std::size_t chunk) {
+				partials[chunk] = function(chunk * grain, std::min(chunk * grain + grain, size));
+			});
+
+			Vector<N, NumericT> total(ZERO);
+
+			for (const auto & partial : partials)
+				total += partial;
+
+			return total;
+		}
+	};
+}
@@ -0,0 +1,15 @@
+//
+//  DualQuaternion.cpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "DualQuaternion.hpp"
+
+namespace Numerics
+{
+	template class DualQuaternion<float>;
+	template class DualQuaternion<double>;
+}
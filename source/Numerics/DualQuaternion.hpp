@@ -0,0 +1,159 @@
+//
+//  DualQuaternion.hpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "Quaternion.hpp"
+#include "Matrix.hpp"
+
+#include <cstdint>
+
+namespace Numerics
+{
+	/// A rigid transform (rotation followed by translation) in 3D, represented as a real quaternion for the rotation and a dual quaternion which encodes the translation.
+	/// Unlike matrices, dual quaternions can be blended linearly without the volume loss ("candy-wrapper") artifacts, and take 8 numbers rather than 16.
+	template <typename NumericT = RealT>
+	class DualQuaternion
+	{
+	public:
+		/// The rotation.
+		Quaternion<NumericT> real;
+
+		/// Half the translation, as a pure quaternion, multiplied by the rotation.
+		Quaternion<NumericT> dual;
+
+		/// Undefined constructor.
+		DualQuaternion() = default;
+
+		/// Identity constructor.
+		DualQuaternion(const Identity &) : real(IDENTITY), dual(Vector<4, NumericT>(ZERO)) {}
+
+		DualQuaternion(const Quaternion<NumericT> & real_, const Quaternion<NumericT> & dual_) : real(real_), dual(dual_) {}
+
+		/// Rotate, and then translate.
+		DualQuaternion(const Quaternion<NumericT> & rotation, const Vector<3, NumericT> & translation) : real(rotation)
+		{
+			multiply(dual, Quaternion<NumericT>((translation * NumericT(0.5)).append(0)), rotation);
+		}
+
+		DualQuaternion(const Quaternion<NumericT> & rotation, const Transforms::Translation<3, NumericT> & translation) : DualQuaternion(rotation, translation.offset)
+		{
+		}
+
+		/// Extract the rotation and translation from an affine transform, which must not contain scale.
+		template <std::size_t R, std::size_t C>
+		explicit DualQuaternion(const Matrix<R, C, NumericT> & transform) : DualQuaternion(Quaternion<NumericT>(transform), Vector<3, NumericT>(transform.at(0, C-1), transform.at(1, C-1), transform.at(2, C-1)))
+		{
+			static_assert(R >= 3 && C >= 4, "Matrix must be at least 3x4 to contain rotation and translation!");
+		}
+
+		const Quaternion<NumericT> & rotation() const {return real;}
+
+		/// Compute the translation, 2 * dual * conjugate(real).
+		Vector<3, NumericT> translation() const
+		{
+			auto r = real.reduce(), d = dual.reduce();
+
+			return (d * real[W] - r * dual[W] + cross_product(r, d)) * NumericT(2);
+		}
+
+		/// Transform a point.
+		Vector<3, NumericT> operator*(const Vector<3, NumericT> & point) const
+		{
+			return real * point + translation();
+		}
+
+		/// Compose two transforms, such that (a * b) * p == a * (b * p).
+		DualQuaternion operator*(const DualQuaternion & other) const
+		{
+			DualQuaternion result;
+			Quaternion<NumericT> a, b;
+
+			multiply(result.real, real, other.real);
+			multiply(a, real, other.dual);
+			multiply(b, dual, other.real);
+
+			result.dual = a + b;
+
+			return result;
+		}
+
+		DualQuaternion & operator*=(const DualQuaternion & other)
+		{
+			return *this = (*this * other);
+		}
+
+		/// The inverse of a unit dual quaternion.
+		DualQuaternion conjugate() const
+		{
+			return {real.conjugate(), dual.conjugate()};
+		}
+
+		/// Scale to unit length, and remove any part of the dual which is not orthogonal to the real, e.g. after accumulating rounding error from composition.
+		DualQuaternion normalize() const
+		{
+			NumericT scale = NumericT(1) / real.length();
+
+			// Quaternion::operator* is the rotation product, so scale them as vectors:
+			Vector<4, NumericT> r = vector(real) * scale, d = vector(dual) * scale;
+
+			return {Quaternion<NumericT>(r), Quaternion<NumericT>(d - r * r.dot(d))};
+		}
+
+		bool equivalent(const DualQuaternion & other) const
+		{
+			return real.equivalent(other.real) && dual.equivalent(other.dual);
+		}
+
+	private:
+		static const Vector<4, NumericT> & vector(const Quaternion<NumericT> & quaternion)
+		{
+			return quaternion;
+		}
+	};
+
+	/// Transform an array of points, each by its own transform.
+	template <typename NumericT>
+	void multiply(Vector<3, NumericT> * result, const DualQuaternion<NumericT> * left, const Vector<3, NumericT> * right, std::size_t count)
+	{
+		for (std::size_t i = 0; i < count; i += 1)
+			result[i] = left[i] * right[i];
+	}
+
+	/// Dual quaternion linear blending, as used for skinning: for each element, sum the N transforms selected by indices, scaled by the matching weights, and normalize.
+	/// Each transform is negated if required so that it lies in the same hemisphere as the first, so that the blend takes the shorter path.
+	template <std::size_t N, typename NumericT, typename IndexT>
+	void blend(DualQuaternion<NumericT> * result, const DualQuaternion<NumericT> * transforms, const Vector<N, IndexT> * indices, const Vector<N, NumericT> * weights, std::size_t count)
+	{
+		for (std::size_t i = 0; i < count; i += 1) {
+			const auto & pivot = transforms[indices[i][0]].real;
+			Vector<4, NumericT> real(ZERO), dual(ZERO);
+
+			for (std::size_t k = 0; k < N; k += 1) {
+				const auto & transform = transforms[indices[i][k]];
+				NumericT weight = weights[i][k];
+
+				if (pivot.dot(transform.real) < 0) weight = -weight;
+
+				const Vector<4, NumericT> & r = transform.real, & d = transform.dual;
+
+				real += r * weight;
+				dual += d * weight;
+			}
+
+			NumericT scale = NumericT(1) / real.length();
+
+			result[i] = DualQuaternion<NumericT>(Quaternion<NumericT>(real * scale), Quaternion<NumericT>(dual * scale));
+		}
+	}
+
+	extern template class DualQuaternion<float>;
+	extern template class DualQuaternion<double>;
+}
+
+#include "DualQuaternion/SSE.hpp"
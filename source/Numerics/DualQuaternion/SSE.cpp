@@ -0,0 +1,58 @@
+//
+//  SSE.cpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "SSE.hpp"
+
+#ifdef NUMERICS_DUAL_QUATERNION_SSE
+
+#include <xmmintrin.h>
+#include <emmintrin.h>
+
+namespace Numerics
+{
+	namespace
+	{
+		// The dot product, in every lane:
+		inline __m128 dot(__m128 a, __m128 b)
+		{
+			__m128 m = _mm_mul_ps(a, b);
+			
+			m = _mm_add_ps(m, _mm_shuffle_ps(m, m, _MM_SHUFFLE(2, 3, 0, 1)));
+			
+			return _mm_add_ps(m, _mm_shuffle_ps(m, m, _MM_SHUFFLE(1, 0, 3, 2)));
+		}
+	}
+	
+	void blend(DualQuaternion<float> * result, const DualQuaternion<float> * transforms, const Vector<4, std::uint32_t> * indices, const Vector<4, float> * weights, std::size_t count)
+	{
+		const __m128 sign_mask = _mm_set1_ps(-0.0f), one = _mm_set1_ps(1);
+		
+		for (std::size_t i = 0; i < count; i += 1) {
+			__m128 pivot = _mm_loadu_ps(transforms[indices[i][0]].real.data());
+			__m128 real = _mm_setzero_ps(), dual = _mm_setzero_ps();
+			
+			for (std::size_t k = 0; k < 4; k += 1) {
+				const auto & transform = transforms[indices[i][k]];
+				__m128 r = _mm_loadu_ps(transform.real.data()), d = _mm_loadu_ps(transform.dual.data());
+				
+				// Negate the weight if the rotation is in the opposite hemisphere to the pivot:
+				__m128 weight = _mm_xor_ps(_mm_set1_ps(weights[i][k]), _mm_and_ps(dot(pivot, r), sign_mask));
+				
+				real = _mm_add_ps(real, _mm_mul_ps(r, weight));
+				dual = _mm_add_ps(dual, _mm_mul_ps(d, weight));
+			}
+			
+			__m128 scale = _mm_div_ps(one, _mm_sqrt_ps(dot(real, real)));
+			
+			_mm_storeu_ps(result[i].real.data(), _mm_mul_ps(real, scale));
+			_mm_storeu_ps(result[i].dual.data(), _mm_mul_ps(dual, scale));
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,26 @@
+//
+//  SSE.hpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#ifdef __SSE2__
+
+#define NUMERICS_DUAL_QUATERNION_SSE
+
+#include "../DualQuaternion.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Numerics
+{
+	// This is an optimised specialization for SSE2, for the common case of four influences per element:
+	void blend(DualQuaternion<float> * result, const DualQuaternion<float> * transforms, const Vector<4, std::uint32_t> * indices, const Vector<4, float> * weights, std::size_t count);
+}
+
+#endif
@@ -0,0 +1,15 @@
+//
+//  DynamicMatrix.cpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "DynamicMatrix.hpp"
+
+namespace Numerics
+{
+	template class DynamicMatrix<float>;
+	template class DynamicMatrix<double>;
+}
@@ -0,0 +1,130 @@
+//
+//  DynamicMatrix.hpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "DynamicVector.hpp"
+#include "Matrix.hpp"
+
+namespace Numerics
+{
+	/// A heap allocated matrix whose size is determined at run time.
+	/// Like Matrix, the interface uses standard (row, column) notation and the memory layout is column-major.
+	template <typename NumericT = RealT>
+	class DynamicMatrix : public std::vector<NumericT, AlignedAllocator<NumericT>>
+	{
+	public:
+		typedef std::vector<NumericT, AlignedAllocator<NumericT>> StorageT;
+		typedef typename RealTypeTraits<NumericT>::RealT RealT;
+
+		DynamicMatrix() {}
+
+		/// Construct a matrix of the given size. Values are zero initialized.
+		DynamicMatrix(std::size_t rows, std::size_t columns) : StorageT(rows * columns), _rows(rows), _columns(columns) {}
+
+		DynamicMatrix(std::size_t rows, std::size_t columns, const Identity &) : DynamicMatrix(rows, columns)
+		{
+			for (std::size_t i = 0; i < std::min(rows, columns); i += 1)
+				at(i, i) = 1;
+		}
+
+		template <std::size_t R, std::size_t C>
+		DynamicMatrix(const Matrix<R, C, NumericT> & other) : StorageT(other.begin(), other.end()), _rows(R), _columns(C) {}
+
+		template <std::size_t R, std::size_t C>
+		operator Matrix<R, C, NumericT>() const
+		{
+			assert(R == _rows && C == _columns);
+
+			Matrix<R, C, NumericT> result;
+			std::copy(this->begin(), this->end(), result.begin());
+
+			return result;
+		}
+
+		std::size_t rows() const {return _rows;}
+		std::size_t columns() const {return _columns;}
+
+		/// Resize the matrix. Existing values are not preserved, and the new values are zero initialized.
+		void resize(std::size_t rows, std::size_t columns)
+		{
+			this->assign(rows * columns, NumericT(0));
+
+			_rows = rows;
+			_columns = columns;
+		}
+
+		std::size_t offset(std::size_t row, std::size_t column) const {
+			assert(row < _rows && column < _columns);
+
+			return column_major_offset(row, column, _rows);
+		}
+
+		const NumericT & at(std::size_t r, std::size_t c) const
+		{
+			return (*this)[offset(r, c)];
+		}
+
+		NumericT & at(std::size_t r, std::size_t c)
+		{
+			return (*this)[offset(r, c)];
+		}
+
+		/// A pointer to the first element of the given column. Columns are contiguous.
+		const NumericT * column(std::size_t c) const
+		{
+			return this->data() + c * _rows;
+		}
+
+		NumericT * column(std::size_t c)
+		{
+			return this->data() + c * _rows;
+		}
+
+		/// Return a copy of this matrix, transposed.
+		DynamicMatrix transpose() const
+		{
+			DynamicMatrix result(_columns, _rows);
+
+			Numerics::transpose(_rows, _columns, this->data(), _rows, result.data(), _columns);
+
+			return result;
+		}
+
+		bool equivalent(const DynamicMatrix & other) const
+		{
+			if (_rows != other._rows || _columns != other._columns) return false;
+
+			for (std::size_t i = 0; i < this->size(); i += 1) {
+				if (!Numerics::equivalent((*this)[i], other[i])) {
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		bool operator==(const DynamicMatrix & other) const
+		{
+			return _rows == other._rows && _columns == other._columns && static_cast<const StorageT &>(*this) == other;
+		}
+
+		bool operator!=(const DynamicMatrix & other) const
+		{
+			return !((*this) == other);
+		}
+
+	private:
+		std::size_t _rows = 0, _columns = 0;
+	};
+
+	extern template class DynamicMatrix<float>;
+	extern template class DynamicMatrix<double>;
+}
+
+#include "DynamicMatrix/Multiply.hpp"
@@ -0,0 +1,188 @@
+//
+//  Multiply.hpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "../DynamicMatrix.hpp"
+
+// Platform specific micro-kernels:
+#include "../Matrix/SSE.hpp"
+
+namespace Numerics
+{
+	/// Block sizes for the cache blocked matrix multiply. The packed block of the left matrix (ROWS x DEPTH) should fit in L2 cache, and a packed panel of the right matrix (DEPTH x 4) should fit in L1 cache.
+	template <typename NumericT>
+	struct MultiplyBlockingTraits {
+		enum : std::size_t {
+			ROWS = 128 * 4 / sizeof(NumericT),
+			DEPTH = 256,
+			COLUMNS = 4096,
+		};
+	};
+
+	/// Generic register tiled kernel. Accumulates the product of a packed 4 x depth panel (column-major) and a packed depth x 4 panel (row-major) into a 4x4 block of the column-major result.
+	template <typename NumericT>
+	void multiply_accumulate_4x4(NumericT * result, std::size_t stride, const NumericT * left, const NumericT * right, std::size_t depth)
+	{
+		NumericT accumulator[16] = {0};
+
+		for (std::size_t p = 0; p < depth; p += 1, left += 4, right += 4)
+			for (std::size_t c = 0; c < 4; c += 1)
+				for (std::size_t r = 0; r < 4; r += 1)
+					accumulator[c*4 + r] += left[r] * right[c];
+
+		for (std::size_t c = 0; c < 4; c += 1)
+			for (std::size_t r = 0; r < 4; r += 1)
+				result[c*stride + r] += accumulator[c*4 + r];
+	}
+
+	/// Pack a rows x depth block of a column-major matrix into 4 row panels, padding the last panel with zeros.
+	template <typename NumericT>
+	void pack_left_panels(NumericT * packed, const NumericT * left, std::size_t stride, std::size_t rows, std::size_t depth)
+	{
+		for (std::size_t i = 0; i < rows; i += 4) {
+			std::size_t height = std::min<std::size_t>(4, rows - i);
+
+			for (std::size_t p = 0; p < depth; p += 1, packed += 4) {
+				const NumericT * column = left + p * stride + i;
+
+				for (std::size_t r = 0; r < 4; r += 1)
+					packed[r] = r < height ? column[r] : NumericT(0);
+			}
+		}
+	}
+
+	/// Pack a depth x columns block of a column-major matrix into 4 column panels, padding the last panel with zeros.
+	template <typename NumericT>
+	void pack_right_panels(NumericT * packed, const NumericT * right, std::size_t stride, std::size_t depth, std::size_t columns)
+	{
+		for (std::size_t j = 0; j < columns; j += 4) {
+			std::size_t width = std::min<std::size_t>(4, columns - j);
+
+			for (std::size_t p = 0; p < depth; p += 1, packed += 4) {
+				for (std::size_t c = 0; c < 4; c += 1)
+					packed[c] = c < width ? right[(j + c) * stride + p] : NumericT(0);
+			}
+		}
+	}
+
+	/*
+	 * Cache blocked multiply of column-major matrices: result (rows x columns) += left (rows x depth) * right (depth x columns).
+	 *
+	 * The right matrix is split into blocks of COLUMNS x DEPTH which are packed into 4 column panels, and the left matrix is split into blocks of ROWS x DEPTH which are packed into 4 row panels. Each pair of panels is multiplied by the 4x4 register tiled kernel.
+	 */
+	template <typename NumericT>
+	void multiply(std::size_t rows, std::size_t columns, std::size_t depth, NumericT * result, std::size_t result_stride, const NumericT * left, std::size_t left_stride, const NumericT * right, std::size_t right_stride)
+	{
+		typedef MultiplyBlockingTraits<NumericT> B;
+
+		if (rows == 0 || columns == 0 || depth == 0) return;
+
+		std::vector<NumericT, AlignedAllocator<NumericT>> packed_left(((std::min<std::size_t>(rows, B::ROWS) + 3) & ~3) * std::min<std::size_t>(depth, B::DEPTH));
+		std::vector<NumericT, AlignedAllocator<NumericT>> packed_right(((std::min<std::size_t>(columns, B::COLUMNS) + 3) & ~3) * std::min<std::size_t>(depth, B::DEPTH));
+
+		// Partial blocks at the edges of the result are computed here and then copied out:
+		alignas(16) NumericT edge[16];
+
+		for (std::size_t jc = 0; jc < columns; jc += B::COLUMNS) {
+			std::size_t nc = std::min<std::size_t>(B::COLUMNS, columns - jc);
+
+			for (std::size_t pc = 0; pc < depth; pc += B::DEPTH) {
+				std::size_t kc = std::min<std::size_t>(B::DEPTH, depth - pc);
+
+				pack_right_panels(packed_right.data(), right + jc * right_stride + pc, right_stride, kc, nc);
+
+				for (std::size_t ic = 0; ic < rows; ic += B::ROWS) {
+					std::size_t mc = std::min<std::size_t>(B::ROWS, rows - ic);
+
+					pack_left_panels(packed_left.data(), left + pc * left_stride + ic, left_stride, mc, kc);
+
+					for (std::size_t jr = 0; jr < nc; jr += 4) {
+						const NumericT * right_panel = packed_right.data() + jr * kc;
+
+						for (std::size_t ir = 0; ir < mc; ir += 4) {
+							const NumericT * left_panel = packed_left.data() + ir * kc;
+							NumericT * block = result + (jc + jr) * result_stride + (ic + ir);
+
+							std::size_t height = std::min<std::size_t>(4, mc - ir), width = std::min<std::size_t>(4, nc - jr);
+
+							if (height == 4 && width == 4) {
+								multiply_accumulate_4x4(block, result_stride, left_panel, right_panel, kc);
+							} else {
+								std::fill(edge, edge + 16, NumericT(0));
+
+								multiply_accumulate_4x4(edge, std::size_t(4), left_panel, right_panel, kc);
+
+								for (std::size_t c = 0; c < width; c += 1)
+									for (std::size_t r = 0; r < height; r += 1)
+										block[c * result_stride + r] += edge[c*4 + r];
+							}
+						}
+					}
+				}
+			}
+		}
+	}
+
+	/// Matrix-vector multiply of a column-major matrix: result (rows) += left (rows x columns) * right (columns). Four columns are accumulated per pass over the result.
+	template <typename NumericT>
+	void multiply(std::size_t rows, std::size_t columns, NumericT * result, const NumericT * left, std::size_t left_stride, const NumericT * right)
+	{
+		std::size_t c = 0;
+
+		for (; c + 4 <= columns; c += 4) {
+			const NumericT * c0 = left + c * left_stride, * c1 = c0 + left_stride, * c2 = c1 + left_stride, * c3 = c2 + left_stride;
+			NumericT x0 = right[c], x1 = right[c+1], x2 = right[c+2], x3 = right[c+3];
+
+			for (std::size_t r = 0; r < rows; r += 1)
+				result[r] += (c0[r] * x0 + c1[r] * x1) + (c2[r] * x2 + c3[r] * x3);
+		}
+
+		for (; c < columns; c += 1)
+			axpy(rows, right[c], left + c * left_stride, result);
+	}
+
+	template <typename NumericT>
+	void multiply(DynamicMatrix<NumericT> & result, const DynamicMatrix<NumericT> & left, const DynamicMatrix<NumericT> & right)
+	{
+		assert(left.columns() == right.rows());
+		assert(result.rows() == left.rows() && result.columns() == right.columns());
+
+		multiply(left.rows(), right.columns(), left.columns(), result.data(), result.rows(), left.data(), left.rows(), right.data(), right.rows());
+	}
+
+	template <typename NumericT>
+	void multiply(DynamicVector<NumericT> & result, const DynamicMatrix<NumericT> & left, const DynamicVector<NumericT> & right)
+	{
+		assert(left.columns() == right.size() && left.rows() == result.size());
+
+		multiply(left.rows(), left.columns(), result.data(), left.data(), left.rows(), right.data());
+	}
+
+	/// Short hand for matrix multiplication
+	template <typename NumericT>
+	DynamicMatrix<NumericT> operator*(const DynamicMatrix<NumericT> & left, const DynamicMatrix<NumericT> & right)
+	{
+		DynamicMatrix<NumericT> result(left.rows(), right.columns());
+
+		multiply(result, left, right);
+
+		return result;
+	}
+
+	/// Short hand for matrix-vector multiplication
+	template <typename NumericT>
+	DynamicVector<NumericT> operator*(const DynamicMatrix<NumericT> & left, const DynamicVector<NumericT> & right)
+	{
+		DynamicVector<NumericT> result(left.rows());
+
+		multiply(result, left, right);
+
+		return result;
+	}
+}
@@ -0,0 +1,190 @@
+//
+//  DynamicVector.hpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "Vector.hpp"
+#include "Memory.hpp"
+#include "Summation.hpp"
+
+#include <vector>
+#include <initializer_list>
+#include <iterator>
+#include <cassert>
+
+namespace Numerics
+{
+	/// y = alpha * x + y
+	template <typename NumericT>
+	void axpy(std::size_t size, const NumericT & alpha, const NumericT * x, NumericT * y)
+	{
+		for (std::size_t i = 0; i < size; i += 1)
+			y[i] += alpha * x[i];
+	}
+
+	/// x = alpha * x
+	template <typename NumericT>
+	void scale(std::size_t size, const NumericT & alpha, NumericT * x)
+	{
+		for (std::size_t i = 0; i < size; i += 1)
+			x[i] *= alpha;
+	}
+
+	/// The euclidean norm of x. The sum of squares is scaled by the largest magnitude so that it can't overflow or underflow.
+	template <typename NumericT>
+	Number<typename RealTypeTraits<NumericT>::RealT> nrm2(std::size_t size, const NumericT * x)
+	{
+		typedef typename RealTypeTraits<NumericT>::RealT RealT;
+
+		RealT maximum = 0;
+
+		for (std::size_t i = 0; i < size; i += 1)
+			maximum = std::max<RealT>(maximum, std::abs(x[i]));
+
+		if (maximum == 0) return maximum;
+
+		RealT reciprocal = RealT(1) / maximum, s0 = 0, s1 = 0;
+		std::size_t i = 0;
+
+		for (; i + 2 <= size; i += 2) {
+			RealT a = x[i+0] * reciprocal, b = x[i+1] * reciprocal;
+
+			s0 += a * a;
+			s1 += b * b;
+		}
+
+		for (; i < size; i += 1) {
+			RealT a = x[i] * reciprocal;
+			s0 += a * a;
+		}
+
+		return maximum * std::sqrt(s0 + s1);
+	}
+
+	/// A heap allocated vector whose size is determined at run time. The storage is aligned for SIMD access.
+	template <typename NumericT = RealT>
+	class DynamicVector : public std::vector<NumericT, AlignedAllocator<NumericT>>
+	{
+	public:
+		typedef std::vector<NumericT, AlignedAllocator<NumericT>> StorageT;
+
+		DynamicVector() {}
+
+		/// Construct a vector of the given size. Values are zero initialized.
+		explicit DynamicVector(std::size_t size) : StorageT(size) {}
+
+		DynamicVector(std::size_t size, const NumericT & value) : StorageT(size, value) {}
+
+		DynamicVector(std::initializer_list<NumericT> values) : StorageT(values) {}
+
+		template <typename IteratorT, typename = typename std::iterator_traits<IteratorT>::iterator_category>
+		DynamicVector(IteratorT begin, IteratorT end) : StorageT(begin, end) {}
+
+		template <std::size_t D>
+		DynamicVector(const Vector<D, NumericT> & other) : StorageT(other.begin(), other.end()) {}
+
+		bool equivalent(const DynamicVector & other) const
+		{
+			if (this->size() != other.size()) return false;
+
+			for (std::size_t i = 0; i < this->size(); i += 1) {
+				if (!Numerics::equivalent((*this)[i], other[i]))
+					return false;
+			}
+
+			return true;
+		}
+
+		DynamicVector & operator+=(const DynamicVector & other)
+		{
+			assert(this->size() == other.size());
+
+			axpy(this->size(), NumericT(1), other.data(), this->data());
+
+			return *this;
+		}
+
+		DynamicVector operator+(const DynamicVector & other) const
+		{
+			return DynamicVector(*this) += other;
+		}
+
+		DynamicVector & operator-=(const DynamicVector & other)
+		{
+			assert(this->size() == other.size());
+
+			axpy(this->size(), NumericT(-1), other.data(), this->data());
+
+			return *this;
+		}
+
+		DynamicVector operator-(const DynamicVector & other) const
+		{
+			return DynamicVector(*this) -= other;
+		}
+
+		DynamicVector & operator*=(const NumericT & factor)
+		{
+			scale(this->size(), factor, this->data());
+
+			return *this;
+		}
+
+		DynamicVector operator*(const NumericT & factor) const
+		{
+			return DynamicVector(*this) *= factor;
+		}
+
+		template <Summation SUMMATION = UNROLLED>
+		Number<NumericT> sum() const
+		{
+			return Numerics::sum<SUMMATION>(this->size(), this->data());
+		}
+
+		template <Summation SUMMATION = UNROLLED>
+		Number<NumericT> dot(const DynamicVector & other) const
+		{
+			assert(this->size() == other.size());
+
+			return Numerics::dot<SUMMATION>(this->size(), this->data(), other.data());
+		}
+
+		Number<NumericT> length_squared() const
+		{
+			return dot(*this);
+		}
+
+		auto length() const
+		{
+			return nrm2(this->size(), this->data());
+		}
+	};
+
+	template <typename NumericT>
+	void axpy(const NumericT & alpha, const DynamicVector<NumericT> & x, DynamicVector<NumericT> & y)
+	{
+		assert(x.size() == y.size());
+
+		axpy(x.size(), alpha, x.data(), y.data());
+	}
+
+	template <Summation SUMMATION = UNROLLED, typename NumericT>
+	Number<NumericT> dot(const DynamicVector<NumericT> & x, const DynamicVector<NumericT> & y)
+	{
+		return x.template dot<SUMMATION>(y);
+	}
+
+	template <typename NumericT>
+	auto nrm2(const DynamicVector<NumericT> & x)
+	{
+		return nrm2(x.size(), x.data());
+	}
+
+	extern template class DynamicVector<float>;
+	extern template class DynamicVector<double>;
+}
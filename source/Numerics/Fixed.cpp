@@ -0,0 +1,15 @@
+//
+//  Fixed.cpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Fixed.hpp"
+
+namespace Numerics
+{
+	template struct Fixed<16, 16>;
+	template struct Fixed<8, 24>;
+}
@@ -0,0 +1,377 @@
+//
+//  Fixed.hpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "Integer.hpp"
+#include "Float.hpp"
+
+#include "Fixed/SSE.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace Numerics
+{
+	/// What a fixed point operation does with a result that can't be represented.
+	enum Overflow
+	{
+		/// Clamp to the largest or smallest representable value.
+		SATURATE,
+		/// Discard the high bits, as two's complement integer arithmetic does.
+		WRAP,
+	};
+
+	/// A signed binary fixed point number with IntBits integer bits (including the sign bit) and FracBits fraction bits, stored in an 8, 16 or 32-bit integer. Every operation is computed with integer arithmetic and is rounded the same way on every machine, so results are bit-exact across platforms and compilers.
+	///
+	/// Floating point values are only used for conversion in and out, which is exact or correctly rounded. Multiplication rounds to nearest and division truncates towards zero. Division by zero gives the largest or smallest value, in both modes. Right shifts of negative values are assumed to be arithmetic, as they are on every supported compiler.
+	template <unsigned IntBits, unsigned FracBits, Overflow OverflowMode = SATURATE>
+	struct Fixed
+	{
+		static_assert(IntBits > 0 && FracBits > 0, "Fixed needs at least one integer (sign) bit and one fraction bit!");
+		static_assert(IntBits + FracBits == 8 || IntBits + FracBits == 16 || IntBits + FracBits == 32, "Fixed must be stored in an 8, 16 or 32-bit integer!");
+
+		typedef typename IntegerSizeTraits<(IntBits + FracBits) / 8>::SignedT StorageT;
+		typedef typename IntegerSizeTraits<(IntBits + FracBits) / 4>::SignedT WideT;
+
+		enum : unsigned {INTEGER_BITS = IntBits, FRACTION_BITS = FracBits};
+
+		StorageT bits;
+
+		Fixed() = default;
+
+		constexpr Fixed(FromBits, StorageT bits_) : bits(bits_) {}
+
+		/// Integers, including constants such as ZERO and IDENTITY, are converted exactly if they are in range.
+		template <typename IntegerT, typename std::enable_if<std::is_integral<IntegerT>::value || std::is_enum<IntegerT>::value, int>::type = 0>
+		Fixed(IntegerT value) : bits(narrow(WideT(clamp(value)) * ONE)) {}
+
+		/// Floating point values are rounded to the nearest representable value.
+		template <typename FloatT, typename std::enable_if<std::is_floating_point<FloatT>::value, int>::type = 0>
+		Fixed(FloatT value) : bits(narrow(round(value))) {}
+
+		template <typename FloatT, typename std::enable_if<std::is_floating_point<FloatT>::value, int>::type = 0>
+		explicit operator FloatT() const
+		{
+			return FloatT(bits) * (FloatT(1) / ONE);
+		}
+
+		/// Round towards negative infinity.
+		explicit operator int() const
+		{
+			return int(bits >> FracBits);
+		}
+
+		/// Convert a wide intermediate result to the storage type, according to the overflow mode.
+		static StorageT narrow(WideT value)
+		{
+			if (OverflowMode == SATURATE) {
+				if (value > std::numeric_limits<StorageT>::max()) return std::numeric_limits<StorageT>::max();
+				if (value < std::numeric_limits<StorageT>::min()) return std::numeric_limits<StorageT>::min();
+
+				return StorageT(value);
+			} else {
+				return StorageT(typename std::make_unsigned<StorageT>::type(value));
+			}
+		}
+
+		friend Fixed operator+(const Fixed & a, const Fixed & b)
+		{
+			return Fixed(FROM_BITS, narrow(WideT(a.bits) + b.bits));
+		}
+
+		friend Fixed operator-(const Fixed & a, const Fixed & b)
+		{
+			return Fixed(FROM_BITS, narrow(WideT(a.bits) - b.bits));
+		}
+
+		friend Fixed operator*(const Fixed & a, const Fixed & b)
+		{
+			return Fixed(FROM_BITS, narrow((WideT(a.bits) * b.bits + HALF) >> FracBits));
+		}
+
+		friend Fixed operator/(const Fixed & a, const Fixed & b)
+		{
+			if (b.bits == 0)
+				return Fixed(FROM_BITS, a.bits < 0 ? std::numeric_limits<StorageT>::min() : std::numeric_limits<StorageT>::max());
+
+			return Fixed(FROM_BITS, narrow(WideT(a.bits) * ONE / b.bits));
+		}
+
+		Fixed operator-() const
+		{
+			return Fixed(FROM_BITS, narrow(-WideT(bits)));
+		}
+
+		Fixed operator+() const
+		{
+			return *this;
+		}
+
+		Fixed & operator+=(const Fixed & other) {return *this = *this + other;}
+		Fixed & operator-=(const Fixed & other) {return *this = *this - other;}
+		Fixed & operator*=(const Fixed & other) {return *this = *this * other;}
+		Fixed & operator/=(const Fixed & other) {return *this = *this / other;}
+
+		friend bool operator==(const Fixed & a, const Fixed & b) {return a.bits == b.bits;}
+		friend bool operator!=(const Fixed & a, const Fixed & b) {return a.bits != b.bits;}
+		friend bool operator<(const Fixed & a, const Fixed & b) {return a.bits < b.bits;}
+		friend bool operator<=(const Fixed & a, const Fixed & b) {return a.bits <= b.bits;}
+		friend bool operator>(const Fixed & a, const Fixed & b) {return a.bits > b.bits;}
+		friend bool operator>=(const Fixed & a, const Fixed & b) {return a.bits >= b.bits;}
+
+	private:
+		static constexpr WideT ONE = WideT(1) << FracBits;
+		static constexpr WideT HALF = WideT(1) << (FracBits - 1);
+
+		template <typename IntegerT>
+		static IntegerT clamp(IntegerT value)
+		{
+			// Larger values would overflow the wide type once scaled:
+			const WideT limit = WideT(1) << (IntBits + FracBits - 1);
+
+			if (std::is_signed<IntegerT>::value && value < 0)
+				return std::intmax_t(value) < -std::intmax_t(limit) ? IntegerT(-limit) : value;
+			else
+				return std::uintmax_t(value) > std::uintmax_t(limit) ? IntegerT(limit) : value;
+		}
+
+		template <typename FloatT>
+		static WideT round(FloatT value)
+		{
+			const FloatT limit = FloatT(WideT(1) << (IntBits + FracBits));
+			FloatT scaled = std::nearbyint(value * ONE);
+
+			if (scaled > limit) return WideT(limit);
+			if (scaled < -limit) return WideT(-limit);
+
+			// NaN has no meaningful fixed point value:
+			if (scaled != scaled) return 0;
+
+			return WideT(scaled);
+		}
+	};
+
+	template <unsigned IntBits, unsigned FracBits, Overflow OverflowMode>
+	constexpr typename Fixed<IntBits, FracBits, OverflowMode>::WideT Fixed<IntBits, FracBits, OverflowMode>::ONE;
+
+	template <unsigned IntBits, unsigned FracBits, Overflow OverflowMode>
+	constexpr typename Fixed<IntBits, FracBits, OverflowMode>::WideT Fixed<IntBits, FracBits, OverflowMode>::HALF;
+
+	/// Fixed point arithmetic stays in fixed point, to keep it deterministic.
+	template <unsigned IntBits, unsigned FracBits, Overflow OverflowMode>
+	struct RealTypeTraits<Fixed<IntBits, FracBits, OverflowMode>> {
+		typedef Fixed<IntBits, FracBits, OverflowMode> RealT;
+	};
+
+	template <unsigned IntBits, unsigned FracBits, Overflow OverflowMode>
+	struct EpsilonTraits<Fixed<IntBits, FracBits, OverflowMode>, 0> {
+		typedef typename IntegerSizeTraits<(IntBits + FracBits) / 8>::UnsignedT UnitT;
+
+		// Each multiplication rounds by at most half a unit, and the functions below are accurate to about a unit:
+		constexpr static UnitT UNITS = 4;
+	};
+
+	/// Fixed point numbers are equivalent if they are within a few units in the last place, which is an absolute rather than a relative tolerance.
+	template <unsigned IntBits, unsigned FracBits, Overflow OverflowMode>
+	inline bool equivalent(const Fixed<IntBits, FracBits, OverflowMode> & a, const Fixed<IntBits, FracBits, OverflowMode> & b)
+	{
+		typedef typename Fixed<IntBits, FracBits, OverflowMode>::WideT WideT;
+		WideT difference = WideT(a.bits) - WideT(b.bits);
+
+		return (difference < 0 ? -difference : difference) <= EpsilonTraits<Fixed<IntBits, FracBits, OverflowMode>, 0>::UNITS;
+	}
+
+	template <unsigned IntBits, unsigned FracBits, Overflow OverflowMode>
+	inline Fixed<IntBits, FracBits, OverflowMode> abs(const Fixed<IntBits, FracBits, OverflowMode> & value)
+	{
+		return value.bits < 0 ? -value : value;
+	}
+
+	/// The reciprocal 1/value, rounded to nearest. This is a single wide division, and unlike Fixed(1) / value, works when 1 is not representable.
+	template <unsigned IntBits, unsigned FracBits, Overflow OverflowMode>
+	Fixed<IntBits, FracBits, OverflowMode> reciprocal(const Fixed<IntBits, FracBits, OverflowMode> & value)
+	{
+		typedef Fixed<IntBits, FracBits, OverflowMode> FixedT;
+
+		if (value.bits == 0)
+			return std::numeric_limits<FixedT>::max();
+
+		std::int64_t divisor = value.bits, numerator = std::int64_t(1) << (FracBits * 2);
+		std::int64_t half = (divisor < 0 ? -divisor : divisor) / 2;
+
+		return FixedT(FROM_BITS, FixedT::narrow((numerator + half) / divisor));
+	}
+
+	/// The square root, rounded to nearest. A floating point estimate is corrected with integer arithmetic, so the result is exact on every machine. Negative values give zero.
+	template <unsigned IntBits, unsigned FracBits, Overflow OverflowMode>
+	Fixed<IntBits, FracBits, OverflowMode> sqrt(const Fixed<IntBits, FracBits, OverflowMode> & value)
+	{
+		typedef Fixed<IntBits, FracBits, OverflowMode> FixedT;
+
+		if (value.bits <= 0)
+			return FixedT(FROM_BITS, 0);
+
+		// sqrt(bits / 2^F) * 2^F = sqrt(bits * 2^F):
+		std::uint64_t square = std::uint64_t(value.bits) << FracBits;
+		std::uint64_t root = std::uint64_t(std::sqrt(double(square)));
+
+		while (root * root > square) root -= 1;
+		while ((root + 1) * (root + 1) <= square) root += 1;
+
+		// Round up if square > (root + 0.5)^2 = root^2 + root + 0.25:
+		if (square - root * root > root) root += 1;
+
+		return FixedT(FROM_BITS, FixedT::narrow(root));
+	}
+
+	namespace FixedPoint
+	{
+		/// sin(π/2 u) ≈ u P(u^2) for u in [0, 1], a minimax polynomial in Q30 with a maximum error of 3.4e-9.
+		const std::int64_t SINE[] = {1686629674, -693597876, 85564854, -5016767, 161942};
+
+		/// 2^32 / 2π, to convert radians to a 32-bit fraction of a turn.
+		const std::int64_t TURNS = 683565276;
+
+		/// Convert an angle in Q(FracBits) radians to a fraction of a turn, as a 32-bit unsigned integer which wraps around.
+		template <unsigned FracBits>
+		std::uint32_t phase(std::int64_t radians)
+		{
+			return std::uint32_t(std::uint64_t(radians * TURNS + (std::int64_t(1) << (FracBits - 1))) >> FracBits);
+		}
+
+		/// The sine of a fraction of a turn, in Q30.
+		inline std::int64_t sine(std::uint32_t phase)
+		{
+			std::uint32_t quadrant = phase >> 30;
+			std::int64_t u = phase & 0x3FFFFFFF;
+
+			// The second and fourth quadrants are mirror images of the first and third:
+			if (quadrant & 1) u = (std::int64_t(1) << 30) - u;
+
+			std::int64_t u2 = (u * u) >> 30;
+			std::int64_t p = SINE[4];
+
+			for (std::size_t i = 4; i > 0; i -= 1)
+				p = ((p * u2) >> 30) + SINE[i - 1];
+
+			p = (p * u) >> 30;
+
+			return (quadrant & 2) ? -p : p;
+		}
+
+		/// Round a Q30 value to Q(FracBits).
+		template <unsigned FracBits>
+		std::int64_t from_q30(std::int64_t value)
+		{
+			const unsigned UP = FracBits > 30 ? FracBits - 30 : 0, DOWN = FracBits < 30 ? 30 - FracBits : 0;
+
+			if (DOWN)
+				return (value + (std::int64_t(1) << (DOWN ? DOWN - 1 : 0))) >> DOWN;
+			else
+				return value * (std::int64_t(1) << UP);
+		}
+	}
+
+	/// The sine, using a fixed point polynomial. The angle is reduced to a fraction of a turn exactly, and the result has an error of about one unit.
+	template <unsigned IntBits, unsigned FracBits, Overflow OverflowMode>
+	Fixed<IntBits, FracBits, OverflowMode> sin(const Fixed<IntBits, FracBits, OverflowMode> & angle)
+	{
+		typedef Fixed<IntBits, FracBits, OverflowMode> FixedT;
+
+		return FixedT(FROM_BITS, FixedT::narrow(FixedPoint::from_q30<FracBits>(FixedPoint::sine(FixedPoint::phase<FracBits>(angle.bits)))));
+	}
+
+	template <unsigned IntBits, unsigned FracBits, Overflow OverflowMode>
+	Fixed<IntBits, FracBits, OverflowMode> cos(const Fixed<IntBits, FracBits, OverflowMode> & angle)
+	{
+		typedef Fixed<IntBits, FracBits, OverflowMode> FixedT;
+
+		// A quarter turn ahead:
+		return FixedT(FROM_BITS, FixedT::narrow(FixedPoint::from_q30<FracBits>(FixedPoint::sine(FixedPoint::phase<FracBits>(angle.bits) + (1u << 30)))));
+	}
+
+	/// Element-wise arithmetic on arrays, which gives exactly the same results as the scalar operators. Arrays of 32-bit values use SSE2 where available.
+	template <unsigned IntBits, unsigned FracBits, Overflow OverflowMode>
+	void add(Fixed<IntBits, FracBits, OverflowMode> * result, const Fixed<IntBits, FracBits, OverflowMode> * left, const Fixed<IntBits, FracBits, OverflowMode> * right, std::size_t count)
+	{
+#ifdef NUMERICS_FIXED_SSE
+		if (IntBits + FracBits == 32)
+			return add_fixed(reinterpret_cast<std::int32_t *>(result), reinterpret_cast<const std::int32_t *>(left), reinterpret_cast<const std::int32_t *>(right), count, OverflowMode == SATURATE);
+#endif
+
+		for (std::size_t i = 0; i < count; i += 1)
+			result[i] = left[i] + right[i];
+	}
+
+	template <unsigned IntBits, unsigned FracBits, Overflow OverflowMode>
+	void subtract(Fixed<IntBits, FracBits, OverflowMode> * result, const Fixed<IntBits, FracBits, OverflowMode> * left, const Fixed<IntBits, FracBits, OverflowMode> * right, std::size_t count)
+	{
+#ifdef NUMERICS_FIXED_SSE
+		if (IntBits + FracBits == 32)
+			return subtract_fixed(reinterpret_cast<std::int32_t *>(result), reinterpret_cast<const std::int32_t *>(left), reinterpret_cast<const std::int32_t *>(right), count, OverflowMode == SATURATE);
+#endif
+
+		for (std::size_t i = 0; i < count; i += 1)
+			result[i] = left[i] - right[i];
+	}
+
+	template <unsigned IntBits, unsigned FracBits, Overflow OverflowMode>
+	void multiply(Fixed<IntBits, FracBits, OverflowMode> * result, const Fixed<IntBits, FracBits, OverflowMode> * left, const Fixed<IntBits, FracBits, OverflowMode> * right, std::size_t count)
+	{
+#ifdef NUMERICS_FIXED_SSE
+		if (IntBits + FracBits == 32)
+			return multiply_fixed(reinterpret_cast<std::int32_t *>(result), reinterpret_cast<const std::int32_t *>(left), reinterpret_cast<const std::int32_t *>(right), count, FracBits, OverflowMode == SATURATE);
+#endif
+
+		for (std::size_t i = 0; i < count; i += 1)
+			result[i] = left[i] * right[i];
+	}
+
+	typedef Fixed<16, 16> Fixed16x16;
+	typedef Fixed<8, 24> Fixed8x24;
+
+	extern template struct Fixed<16, 16>;
+	extern template struct Fixed<8, 24>;
+}
+
+namespace std
+{
+	template <unsigned IntBits, unsigned FracBits, Numerics::Overflow OverflowMode>
+	class numeric_limits<Numerics::Fixed<IntBits, FracBits, OverflowMode>>
+	{
+		typedef Numerics::Fixed<IntBits, FracBits, OverflowMode> FixedT;
+		typedef typename FixedT::StorageT StorageT;
+
+	public:
+		static constexpr bool is_specialized = true;
+		static constexpr bool is_signed = true;
+		static constexpr bool is_integer = false;
+		static constexpr bool is_exact = true;
+		static constexpr bool has_infinity = false;
+		static constexpr bool has_quiet_NaN = false;
+		static constexpr bool has_signaling_NaN = false;
+		static constexpr float_denorm_style has_denorm = denorm_absent;
+		static constexpr float_round_style round_style = round_to_nearest;
+		static constexpr bool is_iec559 = false;
+		static constexpr bool is_bounded = true;
+		static constexpr bool is_modulo = OverflowMode == Numerics::WRAP;
+		static constexpr int digits = IntBits + FracBits - 1;
+		static constexpr int radix = 2;
+
+		static constexpr FixedT min() noexcept {return FixedT(Numerics::FROM_BITS, std::numeric_limits<StorageT>::min());}
+		static constexpr FixedT lowest() noexcept {return min();}
+		static constexpr FixedT max() noexcept {return FixedT(Numerics::FROM_BITS, std::numeric_limits<StorageT>::max());}
+		static constexpr FixedT epsilon() noexcept {return FixedT(Numerics::FROM_BITS, 1);}
+		static constexpr FixedT round_error() noexcept {return FixedT(Numerics::FROM_BITS, StorageT(1) << (FracBits - 1));}
+	};
+}
+
@@ -0,0 +1,34 @@
+//
+//  Fixed/IO.hpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "../Fixed.hpp"
+
+#include <iostream>
+
+namespace Numerics {
+	/// Write a fixed point number to an std::ostream, as a decimal value.
+	template <unsigned IntBits, unsigned FracBits, Overflow OverflowMode>
+	std::ostream & operator<<(std::ostream & output, const Fixed<IntBits, FracBits, OverflowMode> & value)
+	{
+		return output << double(value);
+	}
+	
+	/// Read a fixed point number from a std::istream, as a decimal value.
+	template <unsigned IntBits, unsigned FracBits, Overflow OverflowMode>
+	std::istream & operator>>(std::istream & input, Fixed<IntBits, FracBits, OverflowMode> & value)
+	{
+		double decimal;
+		
+		if (input >> decimal)
+			value = decimal;
+		
+		return input;
+	}
+}
@@ -0,0 +1,150 @@
+//
+//  SSE.cpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "SSE.hpp"
+
+#ifdef NUMERICS_FIXED_SSE
+
+#include <emmintrin.h>
+
+#ifdef __SSE4_1__
+#include <smmintrin.h>
+#endif
+
+#include <algorithm>
+#include <limits>
+
+namespace Numerics
+{
+	namespace
+	{
+		// The remaining values are computed in the same way as Fixed::narrow:
+		inline std::int32_t narrow(std::int64_t value, bool saturate)
+		{
+			if (saturate)
+				return std::int32_t(std::max<std::int64_t>(std::min<std::int64_t>(value, std::numeric_limits<std::int32_t>::max()), std::numeric_limits<std::int32_t>::min()));
+			else
+				return std::int32_t(std::uint32_t(value));
+		}
+
+		inline __m128i select(__m128i mask, __m128i a, __m128i b)
+		{
+			return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+		}
+
+		// The value each lane saturates to, given a negative mask for its sign:
+		inline __m128i saturated(__m128i negative)
+		{
+			return _mm_xor_si128(negative, _mm_set1_epi32(std::numeric_limits<std::int32_t>::max()));
+		}
+
+		// A signed overflow happened if both operands of an addition have the same sign, and the sign of the result is different:
+		inline __m128i add_saturate(__m128i a, __m128i b)
+		{
+			__m128i sum = _mm_add_epi32(a, b);
+			__m128i overflow = _mm_srai_epi32(_mm_andnot_si128(_mm_xor_si128(a, b), _mm_xor_si128(a, sum)), 31);
+
+			return select(overflow, saturated(_mm_srai_epi32(a, 31)), sum);
+		}
+
+		inline __m128i subtract_saturate(__m128i a, __m128i b)
+		{
+			__m128i difference = _mm_sub_epi32(a, b);
+			__m128i overflow = _mm_srai_epi32(_mm_and_si128(_mm_xor_si128(a, b), _mm_xor_si128(a, difference)), 31);
+
+			return select(overflow, saturated(_mm_srai_epi32(a, 31)), difference);
+		}
+
+		// The full signed 64-bit products of the even lanes:
+		inline __m128i multiply_even(__m128i a, __m128i b)
+		{
+#ifdef __SSE4_1__
+			return _mm_mul_epi32(a, b);
+#else
+			// The unsigned product is corrected by subtracting b from the high half if a is negative, and vice versa:
+			__m128i product = _mm_mul_epu32(a, b);
+			__m128i correction = _mm_add_epi32(_mm_and_si128(_mm_srai_epi32(a, 31), b), _mm_and_si128(_mm_srai_epi32(b, 31), a));
+
+			return _mm_sub_epi32(product, _mm_slli_epi64(correction, 32));
+#endif
+		}
+
+		inline __m128i multiply(__m128i a, __m128i b, __m128i shift, __m128i high_shift, __m128i half, bool saturate)
+		{
+			const __m128i low_mask = _mm_set_epi32(0, -1, 0, -1);
+
+			__m128i even = _mm_add_epi64(multiply_even(a, b), half);
+			__m128i odd = _mm_add_epi64(multiply_even(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32)), half);
+
+			// The low 32 bits of each product shifted right, which are the same for logical and arithmetic shifts:
+			__m128i result = _mm_or_si128(_mm_and_si128(_mm_srl_epi64(even, shift), low_mask), _mm_slli_epi64(_mm_srl_epi64(odd, shift), 32));
+
+			if (!saturate) return result;
+
+			// The high 32 bits of each product. The shifted product fits in 32 bits if the bits above fraction_bits + 31 are all copies of the sign bit:
+			__m128i high = _mm_or_si128(_mm_srli_epi64(even, 32), _mm_andnot_si128(low_mask, odd));
+			__m128i negative = _mm_srai_epi32(high, 31);
+			__m128i in_range = _mm_cmpeq_epi32(_mm_sra_epi32(high, high_shift), negative);
+
+			return select(in_range, result, saturated(negative));
+		}
+	}
+
+	void add_fixed(std::int32_t * result, const std::int32_t * left, const std::int32_t * right, std::size_t count, bool saturate)
+	{
+		std::size_t i = 0;
+
+		for (; i + 4 <= count; i += 4) {
+			__m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(left + i));
+			__m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(right + i));
+
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(result + i), saturate ? add_saturate(a, b) : _mm_add_epi32(a, b));
+		}
+
+		for (; i < count; i += 1) {
+			result[i] = narrow(std::int64_t(left[i]) + right[i], saturate);
+		}
+	}
+
+	void subtract_fixed(std::int32_t * result, const std::int32_t * left, const std::int32_t * right, std::size_t count, bool saturate)
+	{
+		std::size_t i = 0;
+
+		for (; i + 4 <= count; i += 4) {
+			__m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(left + i));
+			__m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(right + i));
+
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(result + i), saturate ? subtract_saturate(a, b) : _mm_sub_epi32(a, b));
+		}
+
+		for (; i < count; i += 1) {
+			result[i] = narrow(std::int64_t(left[i]) - right[i], saturate);
+		}
+	}
+
+	void multiply_fixed(std::int32_t * result, const std::int32_t * left, const std::int32_t * right, std::size_t count, unsigned fraction_bits, bool saturate)
+	{
+		const __m128i shift = _mm_cvtsi32_si128(fraction_bits), high_shift = _mm_cvtsi32_si128(fraction_bits - 1);
+		const __m128i half = _mm_set1_epi64x(std::int64_t(1) << (fraction_bits - 1));
+
+		std::size_t i = 0;
+
+		for (; i + 4 <= count; i += 4) {
+			__m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(left + i));
+			__m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(right + i));
+
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(result + i), multiply(a, b, shift, high_shift, half, saturate));
+		}
+
+		for (; i < count; i += 1) {
+			result[i] = narrow((std::int64_t(left[i]) * right[i] + (std::int64_t(1) << (fraction_bits - 1))) >> fraction_bits, saturate);
+		}
+	}
+}
+
+#endif
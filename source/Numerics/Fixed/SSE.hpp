@@ -0,0 +1,26 @@
+//
+//  SSE.hpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#ifdef __SSE2__
+
+#define NUMERICS_FIXED_SSE
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Numerics
+{
+	// Element-wise arithmetic on arrays of 32-bit fixed point values, four at a time. Results either saturate or wrap, and products are rounded to nearest, exactly as the scalar Fixed operators do:
+	void add_fixed(std::int32_t * result, const std::int32_t * left, const std::int32_t * right, std::size_t count, bool saturate);
+	void subtract_fixed(std::int32_t * result, const std::int32_t * left, const std::int32_t * right, std::size_t count, bool saturate);
+	void multiply_fixed(std::int32_t * result, const std::int32_t * left, const std::int32_t * right, std::size_t count, unsigned fraction_bits, bool saturate);
+}
+
+#endif
@@ -8,6 +8,179 @@
 
 #include "Float.hpp"
 
+#include <algorithm>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
 namespace Numerics
 {
+	namespace
+	{
+		// Elements are compared in blocks without branching, and a block is only searched for the first mismatch if it contains one:
+		const std::size_t BLOCK = 64;
+
+		template <typename FloatT>
+		void compare(const FloatT * a, const FloatT * b, std::size_t offset, std::size_t count, Comparison & comparison)
+		{
+			typedef FloatEquivalenceTraits<FloatT> Traits;
+
+			for (std::size_t start = offset; start < count; start += BLOCK) {
+				std::size_t end = std::min(start + BLOCK, count), mismatches = 0;
+				typename Traits::UnsignedT maximum_distance = 0;
+
+				for (std::size_t i = start; i < end; i += 1) {
+					mismatches += !Traits::equivalent(a[i], b[i]);
+					maximum_distance = std::max(maximum_distance, Traits::ulp_distance(a[i], b[i]));
+				}
+
+				if (mismatches && comparison.mismatches == 0) {
+					for (std::size_t i = start; i < end; i += 1) {
+						if (!Traits::equivalent(a[i], b[i])) {
+							comparison.first_mismatch = i;
+							break;
+						}
+					}
+				}
+
+				comparison.mismatches += mismatches;
+				comparison.maximum_distance = std::max<std::uint64_t>(comparison.maximum_distance, maximum_distance);
+			}
+		}
+
+		template <typename FloatT>
+		typename FloatEquivalenceTraits<FloatT>::UnsignedT maximum_distance(const FloatT * a, const FloatT * b, std::size_t offset, std::size_t count)
+		{
+			typename FloatEquivalenceTraits<FloatT>::UnsignedT maximum = 0;
+
+			for (std::size_t i = offset; i < count; i += 1)
+				maximum = std::max(maximum, FloatEquivalenceTraits<FloatT>::ulp_distance(a[i], b[i]));
+
+			return maximum;
+		}
+
+#ifdef __SSE2__
+		// SSE2 has no unsigned comparisons, so distances are compared with their sign bit flipped:
+		const std::uint32_t BIAS = 0x80000000;
+
+		inline __m128i select(__m128i mask, __m128i a, __m128i b)
+		{
+			return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+		}
+
+		inline __m128i ordered_integer(__m128 x)
+		{
+			__m128i i = _mm_castps_si128(x);
+			__m128i negative = _mm_srai_epi32(i, 31);
+
+			return select(negative, _mm_sub_epi32(_mm_set1_epi32(BIAS), i), i);
+		}
+
+		// The distance in units in the last place, with the sign bit flipped. Lanes including NaN have the largest distance:
+		inline __m128i biased_distance(__m128 a, __m128 b)
+		{
+			__m128i i = ordered_integer(a), j = ordered_integer(b);
+			__m128i greater = _mm_cmpgt_epi32(i, j);
+			__m128i distance = _mm_sub_epi32(select(greater, i, j), select(greater, j, i));
+
+			distance = _mm_or_si128(distance, _mm_castps_si128(_mm_cmpunord_ps(a, b)));
+
+			return _mm_xor_si128(distance, _mm_set1_epi32(BIAS));
+		}
+
+		inline __m128i maximum(__m128i a, __m128i b)
+		{
+			return select(_mm_cmpgt_epi32(a, b), a, b);
+		}
+
+		inline std::uint32_t horizontal_maximum(__m128i biased)
+		{
+			std::uint32_t lanes[4];
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(lanes), biased);
+
+			return std::max(std::max(lanes[0], lanes[1]), std::max(lanes[2], lanes[3])) ^ BIAS;
+		}
+#endif
+	}
+
+	Comparison equivalent(const float * a, const float * b, std::size_t count)
+	{
+		Comparison comparison;
+		std::size_t i = 0;
+
+#ifdef __SSE2__
+		using E = EpsilonTraits<float, 0>;
+
+		const __m128 SIGN = _mm_set1_ps(-0.0f), SCALE = _mm_set1_ps(E::SCALE), EPSILON = _mm_set1_ps(E::EPSILON);
+		const __m128i UNITS = _mm_set1_epi32(E::UNITS ^ BIAS);
+
+		__m128i maximum_distance = _mm_set1_epi32(BIAS);
+
+		for (; i + 4 <= count; i += 4) {
+			__m128 x = _mm_loadu_ps(a + i), y = _mm_loadu_ps(b + i);
+
+			__m128i distance = biased_distance(x, y);
+			maximum_distance = maximum(maximum_distance, distance);
+
+			// The same rules as FloatEquivalenceTraits::equivalent:
+			__m128 small = _mm_or_ps(_mm_cmplt_ps(_mm_andnot_ps(SIGN, x), SCALE), _mm_cmplt_ps(_mm_andnot_ps(SIGN, y), SCALE));
+			__m128 near = _mm_cmple_ps(_mm_andnot_ps(SIGN, _mm_sub_ps(x, y)), EPSILON);
+			__m128 far = _mm_castsi128_ps(_mm_cmpgt_epi32(distance, UNITS));
+
+			__m128 mismatch = _mm_or_ps(_mm_andnot_ps(near, small), _mm_andnot_ps(small, far));
+			mismatch = _mm_or_ps(mismatch, _mm_cmpunord_ps(x, y));
+
+			if (int mask = _mm_movemask_ps(mismatch)) {
+				for (std::size_t k = 0; k < 4; k += 1) {
+					if (mask & (1 << k)) {
+						if (comparison.mismatches == 0) comparison.first_mismatch = i + k;
+						comparison.mismatches += 1;
+					}
+				}
+			}
+		}
+
+		comparison.maximum_distance = horizontal_maximum(maximum_distance);
+#endif
+
+		compare(a, b, i, count, comparison);
+
+		if (comparison.mismatches == 0) comparison.first_mismatch = count;
+
+		return comparison;
+	}
+
+	Comparison equivalent(const double * a, const double * b, std::size_t count)
+	{
+		Comparison comparison;
+
+		compare(a, b, 0, count, comparison);
+
+		if (comparison.mismatches == 0) comparison.first_mismatch = count;
+
+		return comparison;
+	}
+
+	std::uint32_t ulp_distance(const float * a, const float * b, std::size_t count)
+	{
+		std::size_t i = 0;
+		std::uint32_t result = 0;
+
+#ifdef __SSE2__
+		__m128i biased = _mm_set1_epi32(BIAS);
+
+		for (; i + 4 <= count; i += 4)
+			biased = maximum(biased, biased_distance(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+
+		result = horizontal_maximum(biased);
+#endif
+
+		return std::max(result, maximum_distance(a, b, i, count));
+	}
+
+	std::uint64_t ulp_distance(const double * a, const double * b, std::size_t count)
+	{
+		return maximum_distance(a, b, 0, count);
+	}
 }
@@ -11,14 +11,23 @@
 #include "Integer.hpp"
 
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <limits>
 #include <cmath>
 #include <utility>
 
+#ifdef __SSE__
+#include <xmmintrin.h>
+#endif
+
 namespace Numerics
 {
 	// Default to floating point precision.
 	using RealT = float;
+
+	/// The precision of an approximation. EXACT is accurate to the precision of the argument type. FAST trades accuracy for speed, e.g. by evaluating double arguments with float approximations.
+	enum Precision {EXACT, FAST};
 	
 	/// Helper to get floating point type from a fixed point type.
 	/// By default we map all integer types to the deault floating point precision.
@@ -67,65 +76,53 @@ namespace Numerics
 		using IntegralT = typename IntegerSizeTraits<sizeof(FloatT)>::SignedT;
 		using UnsignedT = typename IntegerSizeTraits<sizeof(FloatT)>::UnsignedT;
 
-		union Conversion {
-			FloatT float_value;
-			IntegralT integer_value;
-		};
-
 		static constexpr IntegralT NEGATIVE_OFFSET = IntegralT(0x80ULL << ((sizeof(FloatT) - 1) * 8));
 
+		// The bit patterns are copied rather than type-punned through a union, which is well defined and doesn't prevent loops from being vectorized:
 		static IntegralT convert_to_integer(const FloatT & value)
 		{
-			Conversion conversion;
-			conversion.float_value = value;
+			IntegralT integer_value;
+			std::memcpy(&integer_value, &value, sizeof(integer_value));
 
-			if (conversion.integer_value < 0)
-				return NEGATIVE_OFFSET - conversion.integer_value;
-			else
-				return conversion.integer_value;
+			return integer_value < 0 ? NEGATIVE_OFFSET - integer_value : integer_value;
 		}
 
 		static FloatT convert_to_float(const IntegralT & value)
 		{
-			Conversion conversion;
-			conversion.integer_value = value;
+			IntegralT integer_value = value < 0 ? NEGATIVE_OFFSET - value : value;
 
-			if (conversion.integer_value < 0)
-				conversion.integer_value = NEGATIVE_OFFSET - conversion.integer_value;
+			FloatT float_value;
+			std::memcpy(&float_value, &integer_value, sizeof(float_value));
 
-			return conversion.float_value;
+			return float_value;
 		}
 
 		static UnsignedT integral_difference(const FloatT & a, const FloatT & b)
 		{
-			// Make lexicographically ordered as a twos-complement int
+			// Make lexicographically ordered as a twos-complement int, and subtract without overflow:
 			IntegralT i = convert_to_integer(a), j = convert_to_integer(b);
 
-			if (i < j)
-				std::swap(i, j);
+			return i < j ? UnsignedT(j) - UnsignedT(i) : UnsignedT(i) - UnsignedT(j);
+		}
 
-			return i - j;
+		/// The number of representable values between a and b, or the largest possible distance if either is NaN.
+		static UnsignedT ulp_distance(const FloatT & a, const FloatT & b)
+		{
+			return (std::isnan(a) || std::isnan(b)) ? std::numeric_limits<UnsignedT>::max() : integral_difference(a, b);
 		}
 
 		// Large MAX_DEVIATIONS may allow NAN to compare equivalent to large floating point numbers and other strange edge cases.
 		static bool equivalent(const FloatT & a, const FloatT & b)
 		{
-			if (std::isnan(a) || std::isnan(b))
-				return false;
-
 			using E = EpsilonTraits<FloatT, 0>;
 
-			if (std::abs(a) < E::SCALE || std::abs(b) < E::SCALE) {
-				auto epsilon = E::EPSILON;
-				
-				// We compare the difference between the two numbers:
-				auto difference = std::abs(a - b);
-				
-				// It needs to be less than the epsilon value:
-				return difference <= epsilon;
-			} else {
-				return integral_difference(a, b) <= E::UNITS;
-			}
+			// Every condition is evaluated without branching. Near zero, we compare the difference between the two numbers, which needs to be less than the epsilon value:
+			bool ordered = !std::isnan(a) & !std::isnan(b);
+			bool small = (std::abs(a) < E::SCALE) | (std::abs(b) < E::SCALE);
+			bool near = std::abs(a - b) <= E::EPSILON;
+			bool close = integral_difference(a, b) <= E::UNITS;
+
+			return ordered & (small ? near : close);
 		}
 	};
 	
@@ -144,4 +141,88 @@ namespace Numerics
 	// {
 	// 	return FloatEquivalenceTraits<long double>::equivalent(a, b);
 	// }
+
+	inline std::uint32_t ulp_distance(const float & a, const float & b)
+	{
+		return FloatEquivalenceTraits<float>::ulp_distance(a, b);
+	}
+
+	inline std::uint64_t ulp_distance(const double & a, const double & b)
+	{
+		return FloatEquivalenceTraits<double>::ulp_distance(a, b);
+	}
+
+	/// The result of comparing two arrays element by element, e.g. computed results against reference data.
+	struct Comparison
+	{
+		/// The number of elements which are not equivalent.
+		std::size_t mismatches = 0;
+
+		/// The index of the first element which is not equivalent, or the number of elements if they all are.
+		std::size_t first_mismatch = 0;
+
+		/// The largest distance between corresponding elements, in units in the last place. Pairs including NaN have the largest possible distance.
+		std::uint64_t maximum_distance = 0;
+
+		explicit operator bool() const {return mismatches == 0;}
+	};
+
+	/// Compare arrays of floating point numbers using the same rules as the scalar equivalent. These use SSE2 where available, and are implemented in Float.cpp.
+	Comparison equivalent(const float * a, const float * b, std::size_t count);
+	Comparison equivalent(const double * a, const double * b, std::size_t count);
+
+	/// The largest distance between corresponding elements, in units in the last place.
+	std::uint32_t ulp_distance(const float * a, const float * b, std::size_t count);
+	std::uint64_t ulp_distance(const double * a, const double * b, std::size_t count);
+
+	/// Computes 1/sqrt(x). The FAST specializations refine the hardware estimate with one step of Newton's method, which has a relative error around 2e-7, and are only valid for finite positive x.
+	template <Precision PRECISION, typename NumericT>
+	struct ReciprocalSquareRoot
+	{
+		static NumericT evaluate(const NumericT & x)
+		{
+			// Types such as Fixed provide their own overload:
+			using std::sqrt;
+
+			return NumericT(1) / sqrt(x);
+		}
+	};
+
+#ifdef __SSE__
+	template <>
+	struct ReciprocalSquareRoot<FAST, float>
+	{
+		static float evaluate(const float & x)
+		{
+			// The estimate flushes denormals to zero, so values outside the normal range use the exact path:
+			if (!(x >= std::numeric_limits<float>::min() && x <= std::numeric_limits<float>::max()))
+				return 1.0f / std::sqrt(x);
+
+			float y = _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(x)));
+
+			return y * (1.5f - 0.5f * x * y * y);
+		}
+	};
+
+	template <>
+	struct ReciprocalSquareRoot<FAST, double>
+	{
+		static double evaluate(const double & x)
+		{
+			// The estimate is computed in single precision, so values outside that range use the exact path:
+			if (!(x >= std::numeric_limits<float>::min() && x <= std::numeric_limits<float>::max()))
+				return 1.0 / std::sqrt(x);
+
+			double y = _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(float(x))));
+
+			return y * (1.5 - 0.5 * x * y * y);
+		}
+	};
+#endif
+
+	template <Precision PRECISION = EXACT, typename NumericT>
+	inline NumericT reciprocal_square_root(const NumericT & x)
+	{
+		return ReciprocalSquareRoot<PRECISION, NumericT>::evaluate(x);
+	}
 }
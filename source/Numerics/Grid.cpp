@@ -0,0 +1,19 @@
+//
+//  Grid.cpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Grid.hpp"
+
+namespace Numerics
+{
+	template class Range<2>;
+	template class Range<3>;
+	template class GridView<2, float>;
+	template class GridView<3, float>;
+	template class Grid<2, float>;
+	template class Grid<3, float>;
+}
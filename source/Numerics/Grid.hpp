@@ -0,0 +1,340 @@
+//
+//  Grid.hpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "Vector.hpp"
+#include "Memory.hpp"
+
+#include <vector>
+#include <iterator>
+#include <algorithm>
+#include <cassert>
+
+namespace Numerics
+{
+	/// The coordinates in the box [origin, origin + size), with the first dimension varying fastest, i.e. in the same order as Vector::distribute. The coordinates are advanced incrementally, so iterating doesn't divide.
+	template <std::size_t D>
+	class Range
+	{
+	public:
+		typedef Vector<D, std::size_t> CoordinateT;
+
+		class Iterator
+		{
+		public:
+			typedef std::forward_iterator_tag iterator_category;
+			typedef CoordinateT value_type;
+			typedef std::ptrdiff_t difference_type;
+			typedef const CoordinateT * pointer;
+			typedef const CoordinateT & reference;
+
+			Iterator(const Range * range, const CoordinateT & coordinate) : _range(range), _coordinate(coordinate) {}
+
+			const CoordinateT & operator*() const { return _coordinate; }
+			const CoordinateT * operator->() const { return &_coordinate; }
+
+			Iterator & operator++()
+			{
+				_coordinate[0] += 1;
+
+				// Carry into the next dimension, which happens once per row:
+				for (std::size_t i = 0; i + 1 < D && _coordinate[i] == _range->_end[i]; i += 1) {
+					_coordinate[i] = _range->_origin[i];
+					_coordinate[i+1] += 1;
+				}
+
+				return *this;
+			}
+
+			Iterator operator++(int)
+			{
+				Iterator result = *this;
+				++(*this);
+				return result;
+			}
+
+			bool operator==(const Iterator & other) const { return _coordinate == other._coordinate; }
+			bool operator!=(const Iterator & other) const { return !(*this == other); }
+
+		private:
+			const Range * _range;
+			CoordinateT _coordinate;
+		};
+
+		Range(const CoordinateT & size) : _origin(ZERO), _end(size) {}
+		Range(const CoordinateT & origin, const CoordinateT & size) : _origin(origin), _end(origin + size) {}
+
+		const CoordinateT & origin() const { return _origin; }
+		CoordinateT size() const { return _end - _origin; }
+
+		bool empty() const
+		{
+			for (std::size_t i = 0; i < D; i += 1)
+				if (_end[i] <= _origin[i]) return true;
+
+			return false;
+		}
+
+		Iterator begin() const
+		{
+			return empty() ? end() : Iterator(this, _origin);
+		}
+
+		Iterator end() const
+		{
+			CoordinateT coordinate = _origin;
+			coordinate[D-1] = std::max(_origin[D-1], _end[D-1]);
+
+			return Iterator(this, coordinate);
+		}
+
+	private:
+		CoordinateT _origin, _end;
+	};
+
+	/// A view of a D-dimensional array of values with the given strides, which doesn't own the values. The first dimension is usually contiguous. Views of sub-regions have the same strides, so a large grid can be traversed one cache sized block at a time.
+	template <std::size_t D, typename ValueT>
+	class GridView
+	{
+	public:
+		typedef Vector<D, std::size_t> CoordinateT;
+
+		/// Iterates over the values in the same order as Range, tracking the offset of the current value incrementally.
+		class Iterator
+		{
+		public:
+			typedef std::forward_iterator_tag iterator_category;
+			typedef ValueT value_type;
+			typedef std::ptrdiff_t difference_type;
+			typedef ValueT * pointer;
+			typedef ValueT & reference;
+
+			Iterator(const GridView * view, const CoordinateT & coordinate, std::size_t offset) : _view(view), _coordinate(coordinate), _offset(offset) {}
+
+			ValueT & operator*() const { return _view->_data[_offset]; }
+			ValueT * operator->() const { return _view->_data + _offset; }
+
+			/// The coordinate of the current value, relative to the view.
+			const CoordinateT & coordinate() const { return _coordinate; }
+			std::size_t offset() const { return _offset; }
+
+			Iterator & operator++()
+			{
+				const auto & size = _view->_size;
+				const auto & strides = _view->_strides;
+
+				_coordinate[0] += 1;
+				_offset += strides[0];
+
+				for (std::size_t i = 0; i + 1 < D && _coordinate[i] == size[i]; i += 1) {
+					_offset += strides[i+1] - size[i] * strides[i];
+
+					_coordinate[i] = 0;
+					_coordinate[i+1] += 1;
+				}
+
+				return *this;
+			}
+
+			Iterator operator++(int)
+			{
+				Iterator result = *this;
+				++(*this);
+				return result;
+			}
+
+			/// Iterators of the same view are compared by coordinate, since the offset isn't unique unless the strides are ascending, e.g. in a transposed view.
+			bool operator==(const Iterator & other) const { return _coordinate == other._coordinate; }
+			bool operator!=(const Iterator & other) const { return !(*this == other); }
+
+		private:
+			const GridView * _view;
+			CoordinateT _coordinate;
+			std::size_t _offset;
+		};
+
+		GridView(ValueT * data, const CoordinateT & size, const CoordinateT & strides) : _data(data), _size(size), _strides(strides) {}
+
+		/// Views of non-const values may be converted to views of const values.
+		template <typename OtherT>
+		GridView(const GridView<D, OtherT> & other) : _data(other.data()), _size(other.size()), _strides(other.strides()) {}
+
+		ValueT * data() const { return _data; }
+		const CoordinateT & size() const { return _size; }
+
+		/// The distance between adjacent values in each dimension, in values.
+		const CoordinateT & strides() const { return _strides; }
+
+		/// The number of values in the view.
+		std::size_t count() const { return _size.product(); }
+		bool empty() const { return count() == 0; }
+
+		std::size_t offset(const CoordinateT & coordinate) const
+		{
+			std::size_t result = 0;
+
+			for (std::size_t i = 0; i < D; i += 1) {
+				assert(coordinate[i] < _size[i]);
+				result += coordinate[i] * _strides[i];
+			}
+
+			return result;
+		}
+
+		ValueT & operator[](const CoordinateT & coordinate) const
+		{
+			return _data[offset(coordinate)];
+		}
+
+		/// The coordinates of every value in the view.
+		Range<D> coordinates() const
+		{
+			return _size;
+		}
+
+		/// A view of the sub-region [origin, origin + size), which must be inside this view.
+		GridView view(const CoordinateT & origin, const CoordinateT & size) const
+		{
+			for (std::size_t i = 0; i < D; i += 1)
+				assert(origin[i] + size[i] <= _size[i]);
+
+			return GridView(_data + offset_unchecked(origin), size, _strides);
+		}
+
+		/// The number of blocks of the given size needed to cover the view, in each dimension.
+		Range<D> blocks(const CoordinateT & block_size) const
+		{
+			CoordinateT count;
+
+			for (std::size_t i = 0; i < D; i += 1)
+				count[i] = (_size[i] + block_size[i] - 1) / block_size[i];
+
+			return count;
+		}
+
+		/// A view of the block at the given block coordinate. Blocks at the edges are smaller if the size isn't a multiple of the block size.
+		GridView block(const CoordinateT & index, const CoordinateT & block_size) const
+		{
+			CoordinateT origin = index * block_size, size;
+
+			for (std::size_t i = 0; i < D; i += 1)
+				size[i] = std::min(block_size[i], _size[i] - origin[i]);
+
+			return view(origin, size);
+		}
+
+		Iterator begin() const
+		{
+			return empty() ? end() : Iterator(this, CoordinateT(ZERO), 0);
+		}
+
+		Iterator end() const
+		{
+			CoordinateT coordinate(ZERO);
+			coordinate[D-1] = _size[D-1];
+
+			return Iterator(this, coordinate, empty() ? 0 : _size[D-1] * _strides[D-1]);
+		}
+
+		/// Invoke function(coordinate, value) for every value, with the first dimension in the innermost loop.
+		template <typename FunctionT>
+		void each(const FunctionT & function) const
+		{
+			for (auto i = begin(), e = end(); i != e; ++i)
+				function(i.coordinate(), *i);
+		}
+
+		void fill(const ValueT & value) const
+		{
+			for (auto & element : *this)
+				element = value;
+		}
+
+	private:
+		ValueT * _data;
+		CoordinateT _size, _strides;
+
+		std::size_t offset_unchecked(const CoordinateT & coordinate) const
+		{
+			std::size_t result = 0;
+
+			for (std::size_t i = 0; i < D; i += 1)
+				result += coordinate[i] * _strides[i];
+
+			return result;
+		}
+	};
+
+	/// A D-dimensional array of values with precomputed strides, e.g. an image or a voxel volume. Rows, i.e. the first dimension, may be padded to a multiple of the given alignment so that every row starts on a SIMD or cache line boundary. The storage is aligned for SIMD access.
+	template <std::size_t D, typename ValueT>
+	class Grid
+	{
+	public:
+		typedef Vector<D, std::size_t> CoordinateT;
+		typedef std::vector<ValueT, AlignedAllocator<ValueT>> StorageT;
+
+		Grid() : _size(ZERO), _strides(ZERO) {}
+
+		/// A grid of the given size. Values are value initialized. The alignment is in values, and padding is only added to the first dimension.
+		explicit Grid(const CoordinateT & size, std::size_t alignment = 1) : _size(size)
+		{
+			assert(alignment > 0);
+
+			_strides[0] = 1;
+
+			for (std::size_t i = 1; i < D; i += 1) {
+				std::size_t extent = i == 1 ? (size[0] + alignment - 1) / alignment * alignment : size[i-1];
+
+				_strides[i] = _strides[i-1] * extent;
+			}
+
+			_storage.resize(_strides[D-1] * size[D-1]);
+		}
+
+		ValueT * data() { return _storage.data(); }
+		const ValueT * data() const { return _storage.data(); }
+
+		const CoordinateT & size() const { return _size; }
+		const CoordinateT & strides() const { return _strides; }
+
+		/// The number of values in the grid, not including padding.
+		std::size_t count() const { return _size.product(); }
+
+		std::size_t offset(const CoordinateT & coordinate) const
+		{
+			return view().offset(coordinate);
+		}
+
+		ValueT & operator[](const CoordinateT & coordinate) { return _storage[offset(coordinate)]; }
+		const ValueT & operator[](const CoordinateT & coordinate) const { return _storage[offset(coordinate)]; }
+
+		GridView<D, ValueT> view() { return {data(), _size, _strides}; }
+		GridView<D, const ValueT> view() const { return {data(), _size, _strides}; }
+
+		/// A view of the sub-region [origin, origin + size).
+		GridView<D, ValueT> view(const CoordinateT & origin, const CoordinateT & size) { return view().view(origin, size); }
+		GridView<D, const ValueT> view(const CoordinateT & origin, const CoordinateT & size) const { return view().view(origin, size); }
+
+		void fill(const ValueT & value)
+		{
+			std::fill(_storage.begin(), _storage.end(), value);
+		}
+
+	private:
+		CoordinateT _size, _strides;
+		StorageT _storage;
+	};
+
+	extern template class Range<2>;
+	extern template class Range<3>;
+	extern template class GridView<2, float>;
+	extern template class GridView<3, float>;
+	extern template class Grid<2, float>;
+	extern template class Grid<3, float>;
+}
@@ -0,0 +1,169 @@
+//
+//  Half.cpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Half.hpp"
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#ifdef __F16C__
+#include <immintrin.h>
+#endif
+
+namespace Numerics
+{
+#ifdef __SSE2__
+	namespace
+	{
+		inline __m128i select(__m128i mask, __m128i a, __m128i b)
+		{
+			return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+		}
+
+		// Narrow eight 32-bit values, each in the range [0, 0xFFFF], to 16 bits. The signed saturation of _mm_packs_epi32 is avoided by sign extending the bottom 16 bits first:
+		inline __m128i pack(__m128i a, __m128i b)
+		{
+			return _mm_packs_epi32(_mm_srai_epi32(_mm_slli_epi32(a, 16), 16), _mm_srai_epi32(_mm_slli_epi32(b, 16), 16));
+		}
+
+		// The same algorithm as Half::decode, except that the exponent is rebiased by multiplying by 2^112, which also normalizes subnormal values:
+		inline __m128 half_to_float(__m128i h)
+		{
+			const __m128i mask_no_sign = _mm_set1_epi32(0x7FFF), was_infinity_or_nan = _mm_set1_epi32(0x7BFF), infinity_or_nan_exponent = _mm_set1_epi32(255 << 23);
+			const __m128 rebias = _mm_castsi128_ps(_mm_set1_epi32((254 - 15) << 23));
+
+			__m128i exponent_mantissa = _mm_and_si128(h, mask_no_sign);
+			__m128i sign = _mm_slli_epi32(_mm_xor_si128(h, exponent_mantissa), 16);
+
+			__m128 scaled = _mm_mul_ps(_mm_castsi128_ps(_mm_slli_epi32(exponent_mantissa, 13)), rebias);
+			__m128i infinity_or_nan = _mm_and_si128(_mm_cmpgt_epi32(exponent_mantissa, was_infinity_or_nan), infinity_or_nan_exponent);
+
+			return _mm_or_ps(scaled, _mm_castsi128_ps(_mm_or_si128(sign, infinity_or_nan)));
+		}
+
+		// The same algorithm as Half::encode, computing both the subnormal and normal results and selecting between them:
+		inline __m128i float_to_half(__m128 f)
+		{
+			const __m128i sign_mask = _mm_set1_epi32(0x80000000), infinity = _mm_set1_epi32(0x7F800000), half_maximum = _mm_set1_epi32((127 + 16) << 23);
+			const __m128i nan_bit = _mm_set1_epi32(0x200), half_infinity = _mm_set1_epi32(0x7C00), minimum_normal = _mm_set1_epi32((127 - 14) << 23);
+			const __m128i subnormal_magic = _mm_set1_epi32(((127 - 15) + (23 - 10) + 1) << 23), normal_bias = _mm_set1_epi32(0xFFF - ((127 - 15) << 23));
+
+			__m128i bits = _mm_castps_si128(f);
+			__m128i sign = _mm_and_si128(bits, sign_mask);
+			__m128i absolute = _mm_xor_si128(bits, sign);
+
+			__m128i is_nan = _mm_cmpgt_epi32(absolute, infinity);
+			__m128i is_regular = _mm_cmpgt_epi32(half_maximum, absolute);
+			__m128i is_subnormal = _mm_cmpgt_epi32(minimum_normal, absolute);
+
+			__m128i infinity_or_nan = _mm_or_si128(_mm_and_si128(is_nan, nan_bit), half_infinity);
+
+			__m128i subnormal = _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(_mm_castsi128_ps(absolute), _mm_castsi128_ps(subnormal_magic))), subnormal_magic);
+
+			// Subtracting -1 when the lowest kept mantissa bit is set rounds ties to even:
+			__m128i odd = _mm_srai_epi32(_mm_slli_epi32(absolute, 31 - 13), 31);
+			__m128i normal = _mm_srli_epi32(_mm_sub_epi32(_mm_add_epi32(absolute, normal_bias), odd), 13);
+
+			__m128i result = select(is_regular, select(is_subnormal, subnormal, normal), infinity_or_nan);
+
+			return _mm_or_si128(result, _mm_srli_epi32(sign, 16));
+		}
+
+		// The same algorithm as BFloat16::encode:
+		inline __m128i float_to_bfloat16(__m128 f)
+		{
+			const __m128i absolute_mask = _mm_set1_epi32(0x7FFFFFFF), infinity = _mm_set1_epi32(0x7F800000), bias = _mm_set1_epi32(0x7FFF), one = _mm_set1_epi32(1), quiet = _mm_set1_epi32(0x00400000);
+
+			__m128i bits = _mm_castps_si128(f);
+			__m128i is_nan = _mm_cmpgt_epi32(_mm_and_si128(bits, absolute_mask), infinity);
+
+			__m128i rounded = _mm_add_epi32(bits, _mm_add_epi32(bias, _mm_and_si128(_mm_srli_epi32(bits, 16), one)));
+
+			return _mm_srli_epi32(select(is_nan, _mm_or_si128(bits, quiet), rounded), 16);
+		}
+	}
+#endif
+
+	void convert(float * result, const Half * source, std::size_t count)
+	{
+		std::size_t i = 0;
+
+#if defined(__F16C__)
+		for (; i + 8 <= count; i += 8)
+			_mm256_storeu_ps(result + i, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i *>(source + i))));
+#elif defined(__SSE2__)
+		const __m128i zero = _mm_setzero_si128();
+
+		for (; i + 8 <= count; i += 8) {
+			__m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + i));
+
+			_mm_storeu_ps(result + i, half_to_float(_mm_unpacklo_epi16(h, zero)));
+			_mm_storeu_ps(result + i + 4, half_to_float(_mm_unpackhi_epi16(h, zero)));
+		}
+#endif
+
+		for (; i < count; i += 1)
+			result[i] = source[i];
+	}
+
+	void convert(Half * result, const float * source, std::size_t count)
+	{
+		std::size_t i = 0;
+
+#if defined(__F16C__)
+		for (; i + 8 <= count; i += 8)
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(result + i), _mm256_cvtps_ph(_mm256_loadu_ps(source + i), _MM_FROUND_TO_NEAREST_INT));
+#elif defined(__SSE2__)
+		for (; i + 8 <= count; i += 8) {
+			__m128i a = float_to_half(_mm_loadu_ps(source + i)), b = float_to_half(_mm_loadu_ps(source + i + 4));
+
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(result + i), pack(a, b));
+		}
+#endif
+
+		for (; i < count; i += 1)
+			result[i] = source[i];
+	}
+
+	void convert(float * result, const BFloat16 * source, std::size_t count)
+	{
+		std::size_t i = 0;
+
+#ifdef __SSE2__
+		const __m128i zero = _mm_setzero_si128();
+
+		// Placing each value in the top half of a 32-bit lane gives the float:
+		for (; i + 8 <= count; i += 8) {
+			__m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + i));
+
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(result + i), _mm_unpacklo_epi16(zero, h));
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(result + i + 4), _mm_unpackhi_epi16(zero, h));
+		}
+#endif
+
+		for (; i < count; i += 1)
+			result[i] = source[i];
+	}
+
+	void convert(BFloat16 * result, const float * source, std::size_t count)
+	{
+		std::size_t i = 0;
+
+#ifdef __SSE2__
+		for (; i + 8 <= count; i += 8) {
+			__m128i a = float_to_bfloat16(_mm_loadu_ps(source + i)), b = float_to_bfloat16(_mm_loadu_ps(source + i + 4));
+
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(result + i), pack(a, b));
+		}
+#endif
+
+		for (; i < count; i += 1)
+			result[i] = source[i];
+	}
+}
@@ -0,0 +1,268 @@
+//
+//  Half.hpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "Float.hpp"
+
+#include <cstring>
+
+namespace Numerics
+{
+	/// An IEEE 754 binary16 storage type, with 1 sign bit, 5 exponent bits and 10 mantissa bits. It converts implicitly to and from float, which is used for all arithmetic, and rounds to nearest even when storing.
+	struct Half
+	{
+		std::uint16_t bits;
+
+		Half() = default;
+
+		constexpr Half(FromBits, std::uint16_t bits_) : bits(bits_) {}
+
+		Half(float value) : bits(encode(value)) {}
+
+		operator float() const {return decode(bits);}
+
+		Half & operator+=(float other) {return *this = float(*this) + other;}
+		Half & operator-=(float other) {return *this = float(*this) - other;}
+		Half & operator*=(float other) {return *this = float(*this) * other;}
+		Half & operator/=(float other) {return *this = float(*this) / other;}
+
+		// http://fgiesen.wordpress.com/2012/03/28/half-to-float-done-quic/
+		static std::uint16_t encode(float value)
+		{
+			std::uint32_t f;
+			std::memcpy(&f, &value, sizeof(f));
+
+			std::uint32_t sign = f & 0x80000000u;
+			f ^= sign;
+
+			std::uint16_t result;
+
+			if (f >= 0x47800000u) {
+				// Too large (including infinity), or NaN:
+				result = f > 0x7F800000u ? 0x7E00 : 0x7C00;
+			} else if (f < 0x38800000u) {
+				// Subnormal or zero. Adding the magic number aligns the 10 mantissa bits at the bottom of the float, rounding to nearest even:
+				const std::uint32_t magic_bits = ((127 - 15) + (23 - 10) + 1) << 23;
+				float magic, aligned;
+				std::memcpy(&magic, &magic_bits, sizeof(magic));
+				std::memcpy(&aligned, &f, sizeof(aligned));
+
+				aligned += magic;
+				std::memcpy(&f, &aligned, sizeof(f));
+
+				result = f - magic_bits;
+			} else {
+				// Rebias the exponent and round to nearest even:
+				std::uint32_t odd = (f >> 13) & 1;
+				f -= (127u - 15u) << 23;
+				f += 0xFFF + odd;
+
+				result = f >> 13;
+			}
+
+			return result | (sign >> 16);
+		}
+
+		static float decode(std::uint16_t bits)
+		{
+			const std::uint32_t EXPONENT = 0x7C00 << 13;
+
+			std::uint32_t f = (bits & 0x7FFF) << 13;
+			std::uint32_t exponent = f & EXPONENT;
+
+			f += (127 - 15) << 23;
+
+			float result;
+
+			if (exponent == EXPONENT) {
+				// Infinity or NaN:
+				f += (128 - 16) << 23;
+				std::memcpy(&result, &f, sizeof(result));
+			} else if (exponent == 0) {
+				// Zero or subnormal, renormalize:
+				f += 1 << 23;
+				std::memcpy(&result, &f, sizeof(result));
+				result -= 6.103515625e-05f;
+			} else {
+				std::memcpy(&result, &f, sizeof(result));
+			}
+
+			return std::copysign(result, (bits & 0x8000) ? -1.0f : 1.0f);
+		}
+	};
+
+	/// A brain floating point storage type, which is the top 16 bits of a float: 1 sign bit, 8 exponent bits and 7 mantissa bits. It has the range of float with less precision. It converts implicitly to and from float, which is used for all arithmetic, and rounds to nearest even when storing.
+	struct BFloat16
+	{
+		std::uint16_t bits;
+
+		BFloat16() = default;
+
+		constexpr BFloat16(FromBits, std::uint16_t bits_) : bits(bits_) {}
+
+		BFloat16(float value) : bits(encode(value)) {}
+
+		operator float() const {return decode(bits);}
+
+		BFloat16 & operator+=(float other) {return *this = float(*this) + other;}
+		BFloat16 & operator-=(float other) {return *this = float(*this) - other;}
+		BFloat16 & operator*=(float other) {return *this = float(*this) * other;}
+		BFloat16 & operator/=(float other) {return *this = float(*this) / other;}
+
+		static std::uint16_t encode(float value)
+		{
+			std::uint32_t f;
+			std::memcpy(&f, &value, sizeof(f));
+
+			// Keep NaN quiet, as rounding could otherwise turn it into infinity:
+			if ((f & 0x7FFFFFFFu) > 0x7F800000u)
+				return (f >> 16) | 0x0040;
+
+			f += 0x7FFF + ((f >> 16) & 1);
+
+			return f >> 16;
+		}
+
+		static float decode(std::uint16_t bits)
+		{
+			std::uint32_t f = std::uint32_t(bits) << 16;
+
+			float result;
+			std::memcpy(&result, &f, sizeof(result));
+
+			return result;
+		}
+	};
+
+	/// Arithmetic on half precision storage types is performed in single precision.
+	template <>
+	struct RealTypeTraits<Half> {
+		typedef float RealT;
+	};
+
+	template <>
+	struct RealTypeTraits<BFloat16> {
+		typedef float RealT;
+	};
+
+	/// The stored value is correctly rounded, so it is within half a unit of the single precision result. We allow for a second rounding, e.g. from the inputs to a calculation.
+	template <>
+	struct EpsilonTraits<Half, 0> {
+		typedef typename IntegerSizeTraits<sizeof(Half)>::UnsignedT UnitT;
+
+		constexpr static float SCALE = 1.0;
+		constexpr static UnitT UNITS = 2;
+		constexpr static float EPSILON = 0.0009765625f * UNITS;
+	};
+
+	template <>
+	struct EpsilonTraits<BFloat16, 0> {
+		typedef typename IntegerSizeTraits<sizeof(BFloat16)>::UnsignedT UnitT;
+
+		constexpr static float SCALE = 1.0;
+		constexpr static UnitT UNITS = 2;
+		constexpr static float EPSILON = 0.0078125f * UNITS;
+	};
+
+	/// FloatEquivalenceTraits compares the bit patterns as sign-magnitude integers of the same size, which works for both storage types as they have the same layout as float.
+	inline bool equivalent(const Half & a, const Half & b)
+	{
+		return FloatEquivalenceTraits<Half>::equivalent(a, b);
+	}
+
+	inline bool equivalent(const BFloat16 & a, const BFloat16 & b)
+	{
+		return FloatEquivalenceTraits<BFloat16>::equivalent(a, b);
+	}
+
+	/// Convert arrays of half precision values to and from single precision. These use F16C and SSE2 where available, and are implemented in Half.cpp.
+	void convert(float * result, const Half * source, std::size_t count);
+	void convert(Half * result, const float * source, std::size_t count);
+	void convert(float * result, const BFloat16 * source, std::size_t count);
+	void convert(BFloat16 * result, const float * source, std::size_t count);
+}
+
+namespace std
+{
+	template <>
+	class numeric_limits<Numerics::Half>
+	{
+		typedef Numerics::Half Half;
+
+	public:
+		static constexpr bool is_specialized = true;
+		static constexpr bool is_signed = true;
+		static constexpr bool is_integer = false;
+		static constexpr bool is_exact = false;
+		static constexpr bool has_infinity = true;
+		static constexpr bool has_quiet_NaN = true;
+		static constexpr bool has_signaling_NaN = true;
+		static constexpr float_denorm_style has_denorm = denorm_present;
+		static constexpr float_round_style round_style = round_to_nearest;
+		static constexpr bool is_iec559 = true;
+		static constexpr bool is_bounded = true;
+		static constexpr bool is_modulo = false;
+		static constexpr int digits = 11;
+		static constexpr int digits10 = 3;
+		static constexpr int max_digits10 = 5;
+		static constexpr int radix = 2;
+		static constexpr int min_exponent = -13;
+		static constexpr int min_exponent10 = -4;
+		static constexpr int max_exponent = 16;
+		static constexpr int max_exponent10 = 4;
+
+		static constexpr Half min() noexcept {return Half(Numerics::FROM_BITS, 0x0400);}
+		static constexpr Half lowest() noexcept {return Half(Numerics::FROM_BITS, 0xFBFF);}
+		static constexpr Half max() noexcept {return Half(Numerics::FROM_BITS, 0x7BFF);}
+		static constexpr Half epsilon() noexcept {return Half(Numerics::FROM_BITS, 0x1400);}
+		static constexpr Half round_error() noexcept {return Half(Numerics::FROM_BITS, 0x3800);}
+		static constexpr Half infinity() noexcept {return Half(Numerics::FROM_BITS, 0x7C00);}
+		static constexpr Half quiet_NaN() noexcept {return Half(Numerics::FROM_BITS, 0x7E00);}
+		static constexpr Half signaling_NaN() noexcept {return Half(Numerics::FROM_BITS, 0x7D00);}
+		static constexpr Half denorm_min() noexcept {return Half(Numerics::FROM_BITS, 0x0001);}
+	};
+
+	template <>
+	class numeric_limits<Numerics::BFloat16>
+	{
+		typedef Numerics::BFloat16 BFloat16;
+
+	public:
+		static constexpr bool is_specialized = true;
+		static constexpr bool is_signed = true;
+		static constexpr bool is_integer = false;
+		static constexpr bool is_exact = false;
+		static constexpr bool has_infinity = true;
+		static constexpr bool has_quiet_NaN = true;
+		static constexpr bool has_signaling_NaN = true;
+		static constexpr float_denorm_style has_denorm = denorm_present;
+		static constexpr float_round_style round_style = round_to_nearest;
+		static constexpr bool is_iec559 = false;
+		static constexpr bool is_bounded = true;
+		static constexpr bool is_modulo = false;
+		static constexpr int digits = 8;
+		static constexpr int digits10 = 2;
+		static constexpr int max_digits10 = 4;
+		static constexpr int radix = 2;
+		static constexpr int min_exponent = -125;
+		static constexpr int min_exponent10 = -37;
+		static constexpr int max_exponent = 128;
+		static constexpr int max_exponent10 = 38;
+
+		static constexpr BFloat16 min() noexcept {return BFloat16(Numerics::FROM_BITS, 0x0080);}
+		static constexpr BFloat16 lowest() noexcept {return BFloat16(Numerics::FROM_BITS, 0xFF7F);}
+		static constexpr BFloat16 max() noexcept {return BFloat16(Numerics::FROM_BITS, 0x7F7F);}
+		static constexpr BFloat16 epsilon() noexcept {return BFloat16(Numerics::FROM_BITS, 0x3C00);}
+		static constexpr BFloat16 round_error() noexcept {return BFloat16(Numerics::FROM_BITS, 0x3F00);}
+		static constexpr BFloat16 infinity() noexcept {return BFloat16(Numerics::FROM_BITS, 0x7F80);}
+		static constexpr BFloat16 quiet_NaN() noexcept {return BFloat16(Numerics::FROM_BITS, 0x7FC0);}
+		static constexpr BFloat16 signaling_NaN() noexcept {return BFloat16(Numerics::FROM_BITS, 0x7FA0);}
+		static constexpr BFloat16 denorm_min() noexcept {return BFloat16(Numerics::FROM_BITS, 0x0001);}
+	};
+}
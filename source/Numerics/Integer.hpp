@@ -47,6 +47,39 @@ namespace Numerics
 		typedef std::int64_t SignedT;
 	};
 	
+	/// An unsigned integer of an arbitrary number of bytes (up to 8), stored as individual bytes so that arrays of it have no padding, e.g. for packed 24 and 48-bit values.
+	template <unsigned Bytes>
+	struct PackedUnsigned
+	{
+		static_assert(Bytes <= 8, "PackedUnsigned can't be larger than 64 bits!");
+
+		std::uint8_t bytes[Bytes];
+
+		PackedUnsigned() = default;
+
+		PackedUnsigned(std::uint64_t value)
+		{
+			for (unsigned i = 0; i < Bytes; i += 1)
+				bytes[i] = std::uint8_t(value >> (i * 8));
+		}
+
+		operator std::uint64_t() const
+		{
+			std::uint64_t value = 0;
+
+			for (unsigned i = 0; i < Bytes; i += 1)
+				value |= std::uint64_t(bytes[i]) << (i * 8);
+
+			return value;
+		}
+	};
+
+	typedef PackedUnsigned<3> UInt24;
+	typedef PackedUnsigned<6> UInt48;
+
+	/// A tag for constructing a numeric storage type directly from its bit pattern.
+	enum FromBits {FROM_BITS};
+
 	/// If the supplied value is a power of two, it is returned, otherwise the next highest power of 2 is calculated and returned. The integral must be
 	// http://acius2.blogspot.com/2007/11/calculating-next-power-of-2.html
 	template <typename IntegralT>
@@ -25,7 +25,7 @@ namespace Numerics
 		template <typename InterpolateT, typename AnyT>
 		inline AnyT cosine(const InterpolateT & t, const AnyT & a, const AnyT & b)
 		{
-			auto f = (1.0 - cos(t * M_PI)) * 0.5;
+			auto f = (1.0 - std::cos(t * M_PI)) * 0.5;
 
 			return a*(1-f) + b*f;
 		}
@@ -11,6 +11,8 @@
 #include "Float.hpp"
 #include "Transforms.hpp"
 
+#include "Matrix/Transpose.hpp"
+
 #include <array>
 #include <cstddef>
 #include <cassert>
@@ -19,6 +21,9 @@ namespace Numerics
 {
 	template <typename NumericT>
 	class Quaternion;
+
+	template <typename NumericT>
+	class DualQuaternion;
 	
 	std::size_t row_major_offset(std::size_t row, std::size_t col, std::size_t sz);
 	std::size_t column_major_offset(std::size_t row, std::size_t col, std::size_t sz);
@@ -50,21 +55,38 @@ namespace Numerics
 		Matrix(const Quaternion<QuaternionNumericT> & rotation) : Matrix(IDENTITY)
 		{
 			static_assert(R >= 3 && C >= 3, "Matrix must be at least 3x3 to contain rotation!");
-			assert(rotation.length().equivalent(1) && "Quaternion magnitude must be 1");
+			assert(rotation.length_squared().equivalent(1) && "Quaternion magnitude must be 1");
 
 			auto x = rotation[X], y = rotation[Y], z = rotation[Z], w = rotation[W];
+			auto x2 = x + x, y2 = y + y, z2 = z + z;
+			auto xx = x * x2, xy = x * y2, xz = x * z2, yy = y * y2, yz = y * z2, zz = z * z2;
+			auto wx = w * x2, wy = w * y2, wz = w * z2;
+
+			// The first three columns are contiguous, so write them directly:
+			NumericT * m = this->data();
+
+			m[0] = 1 - (yy + zz);
+			m[1] = xy + wz;
+			m[2] = xz - wy;
 
-			at(0, 0) = 1.0 - 2.0 * (y*y + z*z);
-			at(0, 1) =       2.0 * (x*y - w*z);
-			at(0, 2) =       2.0 * (x*z + w*y);
+			m[R] = xy - wz;
+			m[R+1] = 1 - (xx + zz);
+			m[R+2] = yz + wx;
+
+			m[R*2] = xz + wy;
+			m[R*2+1] = yz - wx;
+			m[R*2+2] = 1 - (xx + yy);
+		}
+
+		template <typename DualNumericT>
+		Matrix(const DualQuaternion<DualNumericT> & transform) : Matrix(transform.rotation())
+		{
+			static_assert(C >= 4, "Matrix must be at least 3x4 to contain rotation and translation!");
 
-			at(1, 0) =       2.0 * (x*y + w*z);
-			at(1, 1) = 1.0 - 2.0 * (x*x + z*z);
-			at(1, 2) =       2.0 * (y*z - w*x);
+			auto translation = transform.translation();
 
-			at(2, 0) =       2.0 * (x*z - w*y);
-			at(2, 1) =       2.0 * (y*z + w*x);
-			at(2, 2) = 1.0 - 2.0 * (x*x + y*y);
+			for (std::size_t i = 0; i < 3; i += 1)
+				at(i, C-1) = translation[i];
 		}
 
 		template <typename... TailT>
@@ -115,8 +137,10 @@ namespace Numerics
 			static_assert(R == C && (R == 3 || R == 4), "Angle axis rotation is only valid for 3x3 or 4x4 matrices!");
 
 			if (!rotation.identity()) {
-				NumericT s = rotation.angle.sin();
-				NumericT c = rotation.angle.cos();
+				AngleNumericT sa, ca;
+				rotation.angle.sin_cos(sa, ca);
+
+				NumericT s = sa, c = ca;
 				NumericT a = 1.0 - c;
 
 				auto & p = rotation.axis;
@@ -150,8 +174,8 @@ namespace Numerics
 			static_assert(R >= 3 && C >= 3, "Matrix must be size 3 or bigger!");
 
 			if (!fixed_rotation.identity()) {
-				NumericT ca = fixed_rotation.angle.cos();
-				NumericT sa = fixed_rotation.angle.sin();
+				AxisNumericT sa, ca;
+				fixed_rotation.angle.sin_cos(sa, ca);
 
 				at(1, 1) = ca;
 				at(1, 2) = -sa;
@@ -165,8 +189,8 @@ namespace Numerics
 			static_assert(R >= 3 && C >= 3, "Matrix must be size 3 or bigger!");
 
 			if (!fixed_rotation.identity()) {
-				NumericT ca = fixed_rotation.angle.cos();
-				NumericT sa = fixed_rotation.angle.sin();
+				AxisNumericT sa, ca;
+				fixed_rotation.angle.sin_cos(sa, ca);
 
 				at(0, 0) = ca;
 				at(2, 2) = ca;
@@ -180,8 +204,8 @@ namespace Numerics
 			static_assert(R >= 2 && C >= 2, "Matrix must be size 2 or bigger!");
 
 			if (!fixed_rotation.identity()) {
-				NumericT ca = fixed_rotation.angle.cos();
-				NumericT sa = fixed_rotation.angle.sin();
+				AxisNumericT sa, ca;
+				fixed_rotation.angle.sin_cos(sa, ca);
 
 				at(0, 0) = ca;
 				at(1, 1) = ca;
@@ -246,13 +270,27 @@ namespace Numerics
 		{
 			Matrix<C, R, NumericT> result;
 
-			for (std::size_t c = 0; c < C; ++c)
-				for (std::size_t r = 0; r < R; ++r)
-					result.at(c, r) = at(r, c);
+			Numerics::transpose(R, C, this->data(), R, result.data(), C);
 
 			return result;
 		}
 
+		/// Transpose this matrix in place.
+		Matrix & transpose_in_place ()
+		{
+			static_assert(R == C, "Only square matrices can be transposed in place!");
+
+			if (R == 4) {
+				transpose_4x4(this->data(), 4, this->data(), 4);
+			} else {
+				for (std::size_t c = 1; c < C; ++c)
+					for (std::size_t r = 0; r < c; ++r)
+						std::swap((*this)[column_major_offset(r, c, R)], (*this)[column_major_offset(c, r, R)]);
+			}
+
+			return *this;
+		}
+
 		bool equivalent(const Matrix & other) const
 		{
 			for (std::size_t i = 0; i < R*C; i += 1) {
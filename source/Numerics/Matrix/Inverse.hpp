@@ -23,12 +23,7 @@ namespace Numerics
 		NumericT det;
 
 		// transpose matrix
-		for (int i = 0; i < 4; i++) {
-			src[i]        = mat[i*4];
-			src[i + 4]    = mat[i*4 + 1];
-			src[i + 8]    = mat[i*4 + 2];
-			src[i + 12]   = mat[i*4 + 3];
-		}
+		transpose_4x4(src, 4, mat, 4);
 
 		// calculate pairs for first 8 elements (cofactors)
 		tmp[0]  = src[10] * src[15];
@@ -113,4 +108,33 @@ namespace Numerics
 		
 		return result;
 	}
+
+	template <typename NumericT>
+	Matrix<3, 3, NumericT> inverse (const Matrix<3, 3, NumericT> & source)
+	{
+		const NumericT * m = source.data();
+		Matrix<3, 3, NumericT> result;
+		NumericT * dst = result.data();
+
+		// Column-major cofactors, transposed to give the adjugate:
+		dst[0] = m[4]*m[8] - m[7]*m[5];
+		dst[1] = m[7]*m[2] - m[1]*m[8];
+		dst[2] = m[1]*m[5] - m[4]*m[2];
+		dst[3] = m[6]*m[5] - m[3]*m[8];
+		dst[4] = m[0]*m[8] - m[6]*m[2];
+		dst[5] = m[3]*m[2] - m[0]*m[5];
+		dst[6] = m[3]*m[7] - m[6]*m[4];
+		dst[7] = m[6]*m[1] - m[0]*m[7];
+		dst[8] = m[0]*m[4] - m[3]*m[1];
+
+		// calculate determinant
+		NumericT det = m[0]*dst[0] + m[3]*dst[1] + m[6]*dst[2];
+
+		det = 1.0/det;
+
+		for (int j = 0; j < 9; j++)
+			dst[j] *= det;
+
+		return result;
+	}
 }
@@ -64,6 +64,42 @@ namespace Numerics
 		}
 	}
 
+	/// Multiply an array of vectors by the same matrix. The result may be the same array as right.
+	template <std::size_t R, std::size_t C, typename NumericT>
+	void multiply(Vector<R, NumericT> * result, const Matrix<R, C, NumericT> & left, const Vector<C, NumericT> * right, std::size_t count)
+	{
+		for (std::size_t i = 0; i < count; i += 1) {
+			Vector<R, NumericT> value(ZERO);
+
+			multiply(value, left, right[i]);
+
+			result[i] = value;
+		}
+	}
+
+	/// Transform an array of non-homogeneous points by the same matrix. Each point is extended with w = 1 and the result is divided by its w component.
+	template <std::size_t D, typename NumericT>
+	void multiply(Vector<D, NumericT> * result, const Matrix<D+1, D+1, NumericT> & left, const Vector<D, NumericT> * right, std::size_t count)
+	{
+		const std::size_t N = D + 1;
+		const NumericT * m = left.data();
+
+		for (std::size_t i = 0; i < count; i += 1) {
+			NumericT point[N];
+
+			// The translation column:
+			for (std::size_t r = 0; r < N; r += 1)
+				point[r] = m[D*N + r];
+
+			for (std::size_t c = 0; c < D; c += 1)
+				for (std::size_t r = 0; r < N; r += 1)
+					point[r] += m[c*N + r] * right[i][c];
+
+			for (std::size_t r = 0; r < D; r += 1)
+				result[i][r] = point[r] / point[D];
+		}
+	}
+
 	/// Short-hand notation
 	template <std::size_t R, std::size_t C, typename NumericT>
 	Vector<C, NumericT> operator*(const Matrix<R, C, NumericT> & left, const Vector<R, NumericT> & right)
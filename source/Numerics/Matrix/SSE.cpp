@@ -11,6 +11,11 @@
 #ifdef NUMERICS_MATRIX_SSE
 
 #include <xmmintrin.h>
+#include <emmintrin.h>
+
+#ifdef __AVX__
+#include <immintrin.h>
+#endif
 
 namespace Numerics
 {
@@ -37,6 +42,147 @@ namespace Numerics
 			_mm_store_ps(&r[i], r_line);     // r[i] = r_line
 		}
 	}
+	
+	void transpose_4x4(float * result, std::size_t result_stride, const float * source, std::size_t source_stride)
+	{
+		__m128 c0 = _mm_loadu_ps(source), c1 = _mm_loadu_ps(source + source_stride), c2 = _mm_loadu_ps(source + source_stride * 2), c3 = _mm_loadu_ps(source + source_stride * 3);
+		
+		_MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+		
+		_mm_storeu_ps(result, c0);
+		_mm_storeu_ps(result + result_stride, c1);
+		_mm_storeu_ps(result + result_stride * 2, c2);
+		_mm_storeu_ps(result + result_stride * 3, c3);
+	}
+	
+	void transpose_4x4(double * result, std::size_t result_stride, const double * source, std::size_t source_stride)
+	{
+#ifdef __AVX__
+		__m256d c0 = _mm256_loadu_pd(source), c1 = _mm256_loadu_pd(source + source_stride), c2 = _mm256_loadu_pd(source + source_stride * 2), c3 = _mm256_loadu_pd(source + source_stride * 3);
+		
+		// Interleave pairs of columns within each 128-bit lane, then exchange the lanes:
+		__m256d t0 = _mm256_unpacklo_pd(c0, c1), t1 = _mm256_unpackhi_pd(c0, c1), t2 = _mm256_unpacklo_pd(c2, c3), t3 = _mm256_unpackhi_pd(c2, c3);
+		
+		_mm256_storeu_pd(result, _mm256_permute2f128_pd(t0, t2, 0x20));
+		_mm256_storeu_pd(result + result_stride, _mm256_permute2f128_pd(t1, t3, 0x20));
+		_mm256_storeu_pd(result + result_stride * 2, _mm256_permute2f128_pd(t0, t2, 0x31));
+		_mm256_storeu_pd(result + result_stride * 3, _mm256_permute2f128_pd(t1, t3, 0x31));
+#else
+		// Each column is loaded as a low pair (rows 0, 1) and a high pair (rows 2, 3):
+		__m128d l[4], h[4];
+		
+		for (std::size_t c = 0; c < 4; c += 1) {
+			l[c] = _mm_loadu_pd(source + source_stride * c);
+			h[c] = _mm_loadu_pd(source + source_stride * c + 2);
+		}
+		
+		_mm_storeu_pd(result, _mm_unpacklo_pd(l[0], l[1]));
+		_mm_storeu_pd(result + 2, _mm_unpacklo_pd(l[2], l[3]));
+		_mm_storeu_pd(result + result_stride, _mm_unpackhi_pd(l[0], l[1]));
+		_mm_storeu_pd(result + result_stride + 2, _mm_unpackhi_pd(l[2], l[3]));
+		_mm_storeu_pd(result + result_stride * 2, _mm_unpacklo_pd(h[0], h[1]));
+		_mm_storeu_pd(result + result_stride * 2 + 2, _mm_unpacklo_pd(h[2], h[3]));
+		_mm_storeu_pd(result + result_stride * 3, _mm_unpackhi_pd(h[0], h[1]));
+		_mm_storeu_pd(result + result_stride * 3 + 2, _mm_unpackhi_pd(h[2], h[3]));
+#endif
+	}
+	
+	void multiply(Vector<3, float> * result, const Matrix<4, 4, float> & left, const Vector<3, float> * right, std::size_t count)
+	{
+		const float * a = left.data();
+		
+		// The matrix columns stay in registers for the entire batch:
+		__m128 c0 = _mm_load_ps(a), c1 = _mm_load_ps(a + 4), c2 = _mm_load_ps(a + 8), c3 = _mm_load_ps(a + 12);
+		
+		for (std::size_t i = 0; i < count; i += 1) {
+			const float * p = right[i].data();
+			
+			// r_line = c0 * x + c1 * y + c2 * z + c3
+			__m128 r_line = _mm_add_ps(_mm_mul_ps(c0, _mm_set1_ps(p[0])), c3);
+			r_line = _mm_add_ps(_mm_mul_ps(c1, _mm_set1_ps(p[1])), r_line);
+			r_line = _mm_add_ps(_mm_mul_ps(c2, _mm_set1_ps(p[2])), r_line);
+			
+			// Divide by w:
+			r_line = _mm_div_ps(r_line, _mm_shuffle_ps(r_line, r_line, _MM_SHUFFLE(3, 3, 3, 3)));
+			
+			alignas(16) float point[4];
+			_mm_store_ps(point, r_line);
+			
+			result[i][0] = point[0];
+			result[i][1] = point[1];
+			result[i][2] = point[2];
+		}
+	}
+	
+	// Each column of a 3x3 block is loaded as 4 floats, the last of which is discarded. This relies on the alignment padding at the end of the block:
+	static_assert(sizeof(Matrix<3, 3, float>) >= sizeof(float) * 10, "Matrix<3, 3, float> must be padded!");
+	
+	void multiply(Vector<3, float> & result, const Matrix<3, 3, float> * blocks, const std::uint32_t * indices, std::size_t count, const Vector<3, float> * right)
+	{
+		__m128 r_line = _mm_setzero_ps();
+		
+		for (std::size_t k = 0; k < count; k += 1) {
+			const float * a = blocks[k].data();
+			const float * b = right[indices[k]].data();
+			
+			// r_line += column(a, 0) * b[0] + column(a, 1) * b[1] + column(a, 2) * b[2]
+			r_line = _mm_add_ps(_mm_mul_ps(_mm_load_ps(a), _mm_set1_ps(b[0])), r_line);
+			r_line = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(a + 3), _mm_set1_ps(b[1])), r_line);
+			r_line = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(a + 6), _mm_set1_ps(b[2])), r_line);
+		}
+		
+		alignas(16) float line[4];
+		_mm_store_ps(line, r_line);
+		
+		result[0] += line[0];
+		result[1] += line[1];
+		result[2] += line[2];
+	}
+	
+	void multiply_accumulate_4x4(float * result, std::size_t stride, const float * left, const float * right, std::size_t depth)
+	{
+		// The same column * broadcast scheme as above, but with the four result columns held in registers for the entire depth of the panel:
+		__m128 r0 = _mm_setzero_ps(), r1 = _mm_setzero_ps(), r2 = _mm_setzero_ps(), r3 = _mm_setzero_ps();
+		
+		for (std::size_t p = 0; p < depth; p += 1, left += 4, right += 4) {
+			__m128 a_line = _mm_load_ps(left); // a_line = vec4(column(left, p))
+			
+			r0 = _mm_add_ps(_mm_mul_ps(a_line, _mm_set1_ps(right[0])), r0);
+			r1 = _mm_add_ps(_mm_mul_ps(a_line, _mm_set1_ps(right[1])), r1);
+			r2 = _mm_add_ps(_mm_mul_ps(a_line, _mm_set1_ps(right[2])), r2);
+			r3 = _mm_add_ps(_mm_mul_ps(a_line, _mm_set1_ps(right[3])), r3);
+		}
+		
+		_mm_storeu_ps(result, _mm_add_ps(_mm_loadu_ps(result), r0));
+		_mm_storeu_ps(result + stride, _mm_add_ps(_mm_loadu_ps(result + stride), r1));
+		_mm_storeu_ps(result + stride * 2, _mm_add_ps(_mm_loadu_ps(result + stride * 2), r2));
+		_mm_storeu_ps(result + stride * 3, _mm_add_ps(_mm_loadu_ps(result + stride * 3), r3));
+	}
+	
+	void multiply_accumulate_4x4(double * result, std::size_t stride, const double * left, const double * right, std::size_t depth)
+	{
+		// Each column of the 4x4 block is split into a low and high pair:
+		__m128d r[8];
+		
+		for (std::size_t i = 0; i < 8; i += 1)
+			r[i] = _mm_setzero_pd();
+		
+		for (std::size_t p = 0; p < depth; p += 1, left += 4, right += 4) {
+			__m128d a_low = _mm_load_pd(left), a_high = _mm_load_pd(left + 2);
+			
+			for (std::size_t c = 0; c < 4; c += 1) {
+				__m128d b_line = _mm_set1_pd(right[c]);
+				
+				r[c*2+0] = _mm_add_pd(_mm_mul_pd(a_low, b_line), r[c*2+0]);
+				r[c*2+1] = _mm_add_pd(_mm_mul_pd(a_high, b_line), r[c*2+1]);
+			}
+		}
+		
+		for (std::size_t c = 0; c < 4; c += 1, result += stride) {
+			_mm_storeu_pd(result, _mm_add_pd(_mm_loadu_pd(result), r[c*2+0]));
+			_mm_storeu_pd(result + 2, _mm_add_pd(_mm_loadu_pd(result + 2), r[c*2+1]));
+		}
+	}
 }
 
 #endif
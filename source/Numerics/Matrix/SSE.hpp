@@ -15,11 +15,24 @@
 #include "../Matrix.hpp"
 #include "../Vector.hpp"
 
+#include <cstddef>
+#include <cstdint>
+
 namespace Numerics
 {
 	// This is an optimised specialization for SSE2:
 	void multiply(Matrix<4, 4, float> & result, const Matrix<4, 4, float> & left, const Matrix<4, 4, float> & right);
 	//void multiply(Vector<4, float> & result, const Matrix<4, 4, float> & left, const Vector<4, float> & right);
+	
+	// Transform an array of points by the same matrix, including the perspective divide:
+	void multiply(Vector<3, float> * result, const Matrix<4, 4, float> & left, const Vector<3, float> * right, std::size_t count);
+	
+	// Accumulate a row of 3x3 blocks, each multiplied by the vector selected by its index, as used by block sparse matrices:
+	void multiply(Vector<3, float> & result, const Matrix<3, 3, float> * blocks, const std::uint32_t * indices, std::size_t count, const Vector<3, float> * right);
+	
+	// Register tiled kernels for large matrix multiplication. Accumulates the product of a packed 4 x depth panel (column-major) and a packed depth x 4 panel (row-major) into a 4x4 block of the column-major result. Both panels must be 16-byte aligned.
+	void multiply_accumulate_4x4(float * result, std::size_t stride, const float * left, const float * right, std::size_t depth);
+	void multiply_accumulate_4x4(double * result, std::size_t stride, const double * left, const double * right, std::size_t depth);
 }
 
 #endif
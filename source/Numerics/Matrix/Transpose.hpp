@@ -0,0 +1,69 @@
+//
+//  Transpose.hpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <algorithm>
+
+namespace Numerics
+{
+#ifdef __SSE2__
+	// These are optimised specializations for SSE2 (and AVX where available), implemented in SSE.cpp:
+	void transpose_4x4(float * result, std::size_t result_stride, const float * source, std::size_t source_stride);
+	void transpose_4x4(double * result, std::size_t result_stride, const double * source, std::size_t source_stride);
+#endif
+
+	/// Transpose a 4x4 tile of a column-major matrix, where each stride is the distance between columns. The result may be the same as the source.
+	template <typename NumericT>
+	void transpose_4x4(NumericT * result, std::size_t result_stride, const NumericT * source, std::size_t source_stride)
+	{
+		NumericT tile[16];
+
+		for (std::size_t c = 0; c < 4; c += 1)
+			for (std::size_t r = 0; r < 4; r += 1)
+				tile[r*4 + c] = source[c*source_stride + r];
+
+		for (std::size_t c = 0; c < 4; c += 1)
+			std::copy(tile + c*4, tile + c*4 + 4, result + c*result_stride);
+	}
+
+	/*
+	 * Cache oblivious transpose of a column-major (rows x columns) matrix into a column-major (columns x rows) result, where each stride is the distance between columns. The source and result must not overlap.
+	 *
+	 * The matrix is recursively split along its larger dimension until both dimensions fit in cache, and each block is then transposed in 4x4 tiles.
+	 */
+	template <typename NumericT>
+	void transpose(std::size_t rows, std::size_t columns, const NumericT * source, std::size_t source_stride, NumericT * result, std::size_t result_stride)
+	{
+		const std::size_t BLOCK = 32;
+
+		if (rows > BLOCK && rows >= columns) {
+			std::size_t half = ((rows / 2) + 3) & ~std::size_t(3);
+
+			transpose(half, columns, source, source_stride, result, result_stride);
+			transpose(rows - half, columns, source + half, source_stride, result + half * result_stride, result_stride);
+		} else if (columns > BLOCK) {
+			std::size_t half = ((columns / 2) + 3) & ~std::size_t(3);
+
+			transpose(rows, half, source, source_stride, result, result_stride);
+			transpose(rows, columns - half, source + half * source_stride, source_stride, result + half, result_stride);
+		} else {
+			std::size_t tiled_rows = rows & ~std::size_t(3), tiled_columns = columns & ~std::size_t(3);
+
+			for (std::size_t c = 0; c < tiled_columns; c += 4)
+				for (std::size_t r = 0; r < tiled_rows; r += 4)
+					transpose_4x4(result + r * result_stride + c, result_stride, source + c * source_stride + r, source_stride);
+
+			// The ragged right and bottom edges:
+			for (std::size_t c = 0; c < columns; c += 1)
+				for (std::size_t r = (c < tiled_columns ? tiled_rows : 0); r < rows; r += 1)
+					result[r * result_stride + c] = source[c * source_stride + r];
+		}
+	}
+}
@@ -0,0 +1,88 @@
+//
+//  Memory.hpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <limits>
+
+namespace Numerics
+{
+	/// The default alignment of heap allocated numeric storage. This is one cache line, which is also sufficient for the widest SIMD registers.
+	constexpr std::size_t ALIGNMENT = 64;
+
+	/// Allocate memory aligned to the given boundary. The original allocation is stored immediately before the returned pointer.
+	inline void * aligned_allocate(std::size_t size, std::size_t alignment = ALIGNMENT)
+	{
+		void * allocation = std::malloc(size + alignment + sizeof(void *));
+
+		if (allocation == nullptr)
+			throw std::bad_alloc();
+
+		auto address = reinterpret_cast<std::uintptr_t>(allocation) + sizeof(void *);
+		address = (address + alignment - 1) & ~(std::uintptr_t)(alignment - 1);
+
+		reinterpret_cast<void **>(address)[-1] = allocation;
+
+		return reinterpret_cast<void *>(address);
+	}
+
+	/// Free memory previously allocated by aligned_allocate.
+	inline void aligned_free(void * pointer)
+	{
+		if (pointer)
+			std::free(reinterpret_cast<void **>(pointer)[-1]);
+	}
+
+	/// A standard allocator which returns storage aligned to the given boundary, suitable for aligned SIMD loads and stores.
+	template <typename ValueT, std::size_t Alignment = ALIGNMENT>
+	struct AlignedAllocator
+	{
+		static_assert((Alignment & (Alignment - 1)) == 0, "Alignment must be a power of 2!");
+
+		typedef ValueT value_type;
+
+		template <typename OtherT>
+		struct rebind {
+			typedef AlignedAllocator<OtherT, Alignment> other;
+		};
+
+		AlignedAllocator() noexcept {}
+
+		template <typename OtherT>
+		AlignedAllocator(const AlignedAllocator<OtherT, Alignment> &) noexcept {}
+
+		ValueT * allocate(std::size_t count)
+		{
+			if (count > std::numeric_limits<std::size_t>::max() / sizeof(ValueT))
+				throw std::bad_alloc();
+
+			return static_cast<ValueT *>(aligned_allocate(count * sizeof(ValueT), Alignment));
+		}
+
+		void deallocate(ValueT * pointer, std::size_t) noexcept
+		{
+			aligned_free(pointer);
+		}
+
+		template <typename OtherT>
+		bool operator==(const AlignedAllocator<OtherT, Alignment> &) const noexcept
+		{
+			return true;
+		}
+
+		template <typename OtherT>
+		bool operator!=(const AlignedAllocator<OtherT, Alignment> &) const noexcept
+		{
+			return false;
+		}
+	};
+}
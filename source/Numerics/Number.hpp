@@ -12,6 +12,7 @@
 
 #include "Integer.hpp"
 #include "Float.hpp"
+#include "Trigonometry.hpp"
 
 #include <algorithm>
 
@@ -89,7 +90,7 @@ namespace Numerics
 	template <typename NumericT>
 	struct Number
 	{
-		static_assert(std::is_arithmetic<NumericT>::value, "Number can only work with arithmetic data-types!");
+		static_assert(std::numeric_limits<NumericT>::is_specialized, "Number can only work with data-types which specialize std::numeric_limits!");
 		using RealT = typename RealTypeTraits<NumericT>::RealT;
 
 		NumericT value;
@@ -163,7 +164,17 @@ namespace Numerics
 
 		Number<RealT> square_root() const
 		{
-			return std::sqrt(value);
+			// Types such as Fixed provide their own overload:
+			using std::sqrt;
+
+			return sqrt(value);
+		}
+
+		/// 1/sqrt(value), which is faster than a division by the square root when the precision is FAST.
+		template <Precision PRECISION = EXACT>
+		Number<RealT> reciprocal_square_root() const
+		{
+			return Numerics::reciprocal_square_root<PRECISION>(RealT(value));
 		}
 
 		Number fraction() const
@@ -216,9 +227,14 @@ namespace Numerics
 			return Radians<RealT>{std::asin(value)};
 		}
 		
+		/// The FAST precision uses a polynomial approximation, while EXACT uses the standard library.
+		template <Precision PRECISION = EXACT>
 		Radians<RealT> acos() const
 		{
-			return Radians<RealT>{std::acos(value)};
+			if (PRECISION == FAST)
+				return Radians<RealT>{Trigonometry::acos<FAST>(RealT(value))};
+			else
+				return Radians<RealT>{std::acos(value)};
 		}
 		
 		Radians<RealT> atan() const
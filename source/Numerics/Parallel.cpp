@@ -0,0 +1,55 @@
+//
+//  Parallel.cpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Parallel.hpp"
+#include "Parallel/ThreadPool.hpp"
+
+#include <atomic>
+
+namespace Numerics
+{
+	namespace Parallel
+	{
+		Executor::~Executor()
+		{
+		}
+
+		SerialExecutor::~SerialExecutor()
+		{
+		}
+
+		std::size_t SerialExecutor::concurrency() const noexcept
+		{
+			return 1;
+		}
+
+		void SerialExecutor::run(std::size_t count, const std::function<void(std::size_t)> & task)
+		{
+			for (std::size_t i = 0; i < count; i += 1)
+				task(i);
+		}
+
+		namespace {
+			std::atomic<Executor *> current_default_executor{nullptr};
+		}
+
+		Executor & default_executor()
+		{
+			Executor * executor = current_default_executor.load(std::memory_order_acquire);
+
+			if (executor) return *executor;
+
+			return ThreadPool::shared();
+		}
+
+		void set_default_executor(Executor * executor)
+		{
+			current_default_executor.store(executor, std::memory_order_release);
+		}
+	}
+}
@@ -0,0 +1,71 @@
+//
+//  Parallel.hpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <algorithm>
+
+namespace Numerics
+{
+	namespace Parallel
+	{
+		/// The default number of elements processed by a single task in the element-wise kernels.
+		constexpr std::size_t GRAIN = 16 * 1024;
+
+		/// Runs batches of independent tasks. Implement this interface to run the parallel kernels on your own threads.
+		class Executor
+		{
+		public:
+			virtual ~Executor();
+
+			/// The number of tasks which may run at the same time.
+			virtual std::size_t concurrency() const noexcept = 0;
+
+			/// Invoke task(i) for every i in [0, count) and return once they have all completed. If any task throws, the first exception is rethrown after all tasks have completed.
+			virtual void run(std::size_t count, const std::function<void(std::size_t)> & task) = 0;
+		};
+
+		/// Runs all tasks on the calling thread.
+		class SerialExecutor final : public Executor
+		{
+		public:
+			virtual ~SerialExecutor();
+
+			std::size_t concurrency() const noexcept override;
+			void run(std::size_t count, const std::function<void(std::size_t)> & task) override;
+		};
+
+		/// The executor used by the parallel kernels when none is given. This is the shared ThreadPool unless it has been replaced.
+		Executor & default_executor();
+
+		/// Replace the default executor. The executor must outlive its use as the default. Passing nullptr restores the shared ThreadPool.
+		void set_default_executor(Executor * executor);
+
+		/// Split [begin, end) into chunks of at most grain elements and invoke function(chunk_begin, chunk_end) for each chunk. Small ranges are run directly on the calling thread.
+		template <typename FunctionT>
+		void parallel_for(std::size_t begin, std::size_t end, std::size_t grain, const FunctionT & function, Executor & executor = default_executor())
+		{
+			if (end <= begin) return;
+
+			grain = std::max<std::size_t>(grain, 1);
+			std::size_t chunks = (end - begin + grain - 1) / grain;
+
+			if (chunks == 1 || executor.concurrency() == 1) {
+				function(begin, end);
+			} else {
+				executor.run(chunks, [&](std::size_t chunk) {
+					std::size_t first = begin + chunk * grain;
+
+					function(first, std::min(first + grain, end));
+				});
+			}
+		}
+	}
+}
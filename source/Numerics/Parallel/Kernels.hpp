@@ -0,0 +1,130 @@
+//
+//  Kernels.hpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "../Parallel.hpp"
+#include "../DynamicMatrix.hpp"
+
+namespace Numerics
+{
+	namespace Parallel
+	{
+		/// Matrix multiply, result += left * right, split into tiles of the result. Each tile is computed by the cache blocked serial multiply with its own packing buffers. The grain is the number of result columns per tile.
+		template <typename NumericT>
+		void multiply(DynamicMatrix<NumericT> & result, const DynamicMatrix<NumericT> & left, const DynamicMatrix<NumericT> & right, std::size_t grain = 64, Executor & executor = default_executor())
+		{
+			typedef MultiplyBlockingTraits<NumericT> B;
+
+			assert(left.columns() == right.rows());
+			assert(result.rows() == left.rows() && result.columns() == right.columns());
+
+			std::size_t rows = left.rows(), columns = right.columns(), depth = left.columns();
+
+			// Tiles are aligned to the register tile size:
+			grain = std::max<std::size_t>((grain + 3) & ~3, 4);
+
+			std::size_t row_tiles = (rows + B::ROWS - 1) / B::ROWS;
+			std::size_t column_tiles = (columns + grain - 1) / grain;
+
+			parallel_for(0, row_tiles * column_tiles, 1, [&](std::size_t begin, std::size_t end) {
+				for (std::size_t tile = begin; tile < end; tile += 1) {
+					std::size_t i = (tile % row_tiles) * B::ROWS, j = (tile / row_tiles) * grain;
+					std::size_t height = std::min<std::size_t>(B::ROWS, rows - i), width = std::min(grain, columns - j);
+
+					Numerics::multiply(height, width, depth, result.column(j) + i, rows, left.data() + i, rows, right.column(j), depth);
+				}
+			}, executor);
+		}
+
+		/// Matrix-vector multiply, result += left * right, split into blocks of rows.
+		template <typename NumericT>
+		void multiply(DynamicVector<NumericT> & result, const DynamicMatrix<NumericT> & left, const DynamicVector<NumericT> & right, std::size_t grain = 1024, Executor & executor = default_executor())
+		{
+			assert(left.columns() == right.size() && left.rows() == result.size());
+
+			parallel_for(0, left.rows(), grain, [&](std::size_t begin, std::size_t end) {
+				Numerics::multiply(end - begin, left.columns(), result.data() + begin, left.data() + begin, left.rows(), right.data());
+			}, executor);
+		}
+
+		/// Transform an array of points by the same matrix.
+		template <std::size_t D, typename NumericT>
+		void multiply(Vector<D, NumericT> * result, const Matrix<D+1, D+1, NumericT> & left, const Vector<D, NumericT> * right, std::size_t count, std::size_t grain = GRAIN, Executor & executor = default_executor())
+		{
+			parallel_for(0, count, grain, [&](std::size_t begin, std::size_t end) {
+				Numerics::multiply(result + begin, left, right + begin, end - begin);
+			}, executor);
+		}
+
+		/// Multiply an array of vectors by the same matrix.
+		template <std::size_t R, std::size_t C, typename NumericT>
+		void multiply(Vector<R, NumericT> * result, const Matrix<R, C, NumericT> & left, const Vector<C, NumericT> * right, std::size_t count, std::size_t grain = GRAIN, Executor & executor = default_executor())
+		{
+			parallel_for(0, count, grain, [&](std::size_t begin, std::size_t end) {
+				Numerics::multiply(result + begin, left, right + begin, end - begin);
+			}, executor);
+		}
+
+		/// y = alpha * x + y
+		template <typename NumericT>
+		void axpy(std::size_t size, const NumericT & alpha, const NumericT * x, NumericT * y, std::size_t grain = GRAIN, Executor & executor = default_executor())
+		{
+			parallel_for(0, size, grain, [&](std::size_t begin, std::size_t end) {
+				Numerics::axpy(end - begin, alpha, x + begin, y + begin);
+			}, executor);
+		}
+
+		/// x = alpha * x
+		template <typename NumericT>
+		void scale(std::size_t size, const NumericT & alpha, NumericT * x, std::size_t grain = GRAIN, Executor & executor = default_executor())
+		{
+			parallel_for(0, size, grain, [&](std::size_t begin, std::size_t end) {
+				Numerics::scale(end - begin, alpha, x + begin);
+			}, executor);
+		}
+
+		/// The inner product of x and y. Partial sums are always computed per grain and combined in order, so the result doesn't depend on the executor.
+		template <typename NumericT>
+		NumericT dot(std::size_t size, const NumericT * x, const NumericT * y, std::size_t grain = GRAIN, Executor & executor = default_executor())
+		{
+			grain = std::max<std::size_t>(grain, 1);
+
+			std::vector<NumericT> partials((size + grain - 1) / grain, NumericT(0));
+
+			executor.run(partials.size(), [&](std::size_t chunk) {
+				std::size_t begin = chunk * grain, end = std::min(begin + grain, size);
+
+				partials[chunk] = Numerics::dot(end - begin, x + begin, y + begin);
+			});
+
+			NumericT sum = 0;
+
+			for (auto partial : partials)
+				sum += partial;
+
+			return sum;
+		}
+
+		template <typename NumericT>
+		void axpy(const NumericT & alpha, const DynamicVector<NumericT> & x, DynamicVector<NumericT> & y, std::size_t grain = GRAIN, Executor & executor = default_executor())
+		{
+			assert(x.size() == y.size());
+
+			axpy(x.size(), alpha, x.data(), y.data(), grain, executor);
+		}
+
+		template <typename NumericT>
+		Number<NumericT> dot(const DynamicVector<NumericT> & x, const DynamicVector<NumericT> & y, std::size_t grain = GRAIN, Executor & executor = default_executor())
+		{
+			assert(x.size() == y.size());
+
+			return dot(x.size(), x.data(), y.data(), grain, executor);
+		}
+	}
+}
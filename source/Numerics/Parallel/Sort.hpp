@@ -0,0 +1,107 @@
+//
+//  Sort.hpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "../Parallel.hpp"
+#include "../Sort.hpp"
+
+namespace Numerics
+{
+	namespace Parallel
+	{
+		namespace Radix
+		{
+			using namespace Numerics::Radix;
+
+			/// Each pass is split into one contiguous chunk of keys per task. The chunks count their digits in parallel, then each chunk scatters to its own offsets within every bucket, which are ordered by chunk so that the sort is stable.
+			template <typename KeyT, typename ValueT>
+			bool sort(KeyT * keys, ValueT * values, std::size_t count, KeyT * key_buffer, ValueT * value_buffer, std::size_t chunks, Executor & executor)
+			{
+				std::size_t chunk_size = (count + chunks - 1) / chunks;
+				std::vector<HistogramT> histograms(chunks);
+
+				bool swapped = false;
+
+				for (std::size_t pass = 0; pass < Passes<KeyT>::COUNT; pass += 1) {
+					executor.run(chunks, [&](std::size_t chunk) {
+						std::size_t begin = std::min(chunk * chunk_size, count), end = std::min(begin + chunk_size, count);
+
+						histograms[chunk].fill(0);
+						histogram(keys + begin, end - begin, pass, histograms[chunk]);
+					});
+
+					HistogramT total = {};
+
+					for (const auto & histogram : histograms)
+						for (std::size_t bucket = 0; bucket < BUCKETS; bucket += 1)
+							total[bucket] += histogram[bucket];
+
+					if (trivial(total, count)) continue;
+
+					std::size_t offset = 0;
+
+					for (std::size_t bucket = 0; bucket < BUCKETS; bucket += 1) {
+						for (auto & histogram : histograms) {
+							std::size_t size = histogram[bucket];
+							histogram[bucket] = offset;
+							offset += size;
+						}
+					}
+
+					executor.run(chunks, [&](std::size_t chunk) {
+						std::size_t begin = std::min(chunk * chunk_size, count), end = std::min(begin + chunk_size, count);
+
+						scatter(keys + begin, values ? values + begin : values, end - begin, pass, histograms[chunk], key_buffer, value_buffer);
+					});
+
+					std::swap(keys, key_buffer);
+					std::swap(values, value_buffer);
+					swapped = !swapped;
+				}
+
+				return swapped;
+			}
+
+			/// The number of chunks, or 1 if the keys should be sorted on the calling thread.
+			inline std::size_t chunks(std::size_t count, std::size_t grain, Executor & executor)
+			{
+				grain = std::max<std::size_t>(grain, 1);
+
+				return std::max<std::size_t>(1, std::min(executor.concurrency(), count / grain));
+			}
+		}
+
+		/// Radix sort, with the digits of each pass counted and scattered in parallel. Chunks have at least grain keys, and small arrays are sorted on the calling thread.
+		template <typename KeyT>
+		void radix_sort(KeyT * keys, std::size_t count, std::size_t grain = 4 * GRAIN, Executor & executor = default_executor())
+		{
+			std::size_t chunks = Radix::chunks(count, grain, executor);
+
+			if (chunks == 1) return Numerics::radix_sort(keys, count);
+
+			std::vector<KeyT> buffer(count);
+
+			if (Radix::sort(keys, static_cast<KeyT *>(nullptr), count, buffer.data(), static_cast<KeyT *>(nullptr), chunks, executor))
+				std::copy(buffer.begin(), buffer.end(), keys);
+		}
+
+		/// Radix sort of keys and values in parallel, see above.
+		template <typename KeyT, typename ValueT>
+		void radix_sort(KeyT * keys, ValueT * values, std::size_t count, std::size_t grain = 4 * GRAIN, Executor & executor = default_executor())
+		{
+			std::size_t chunks = Radix::chunks(count, grain, executor);
+
+			if (chunks == 1) return Numerics::radix_sort(keys, values, count);
+
+			Numerics::Radix::sort(keys, values, count, [&](KeyT * pass_keys, auto * pass_values, std::size_t size, KeyT * key_buffer, auto * value_buffer) {
+				return Radix::sort(pass_keys, pass_values, size, key_buffer, value_buffer, chunks, executor);
+			});
+		}
+	}
+}
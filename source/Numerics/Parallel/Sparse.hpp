@@ -0,0 +1,95 @@
+//
+//  Sparse.hpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "../Parallel.hpp"
+#include "../BlockSparseMatrix.hpp"
+
+namespace Numerics
+{
+	namespace Parallel
+	{
+		/// Sparse matrix-vector multiply, result += left * right, split into blocks of rows.
+		template <typename NumericT>
+		void multiply(DynamicVector<NumericT> & result, const SparseMatrix<NumericT> & left, const DynamicVector<NumericT> & right, std::size_t grain = 1024, Executor & executor = default_executor())
+		{
+			assert(left.rows() == result.size() && left.columns() == right.size());
+
+			parallel_for(0, left.rows(), grain, [&](std::size_t begin, std::size_t end) {
+				Numerics::multiply(result.data(), left, right.data(), begin, end);
+			}, executor);
+		}
+
+		/// Block sparse matrix-vector multiply, result += left * right, split into blocks of block rows.
+		template <std::size_t R, std::size_t C, typename NumericT>
+		void multiply(Vector<R, NumericT> * result, const BlockSparseMatrix<R, C, NumericT> & left, const Vector<C, NumericT> * right, std::size_t grain = 256, Executor & executor = default_executor())
+		{
+			parallel_for(0, left.rows(), grain, [&](std::size_t begin, std::size_t end) {
+				Numerics::multiply(result, left, right, begin, end);
+			}, executor);
+		}
+
+		template <std::size_t R, std::size_t C, typename NumericT>
+		void multiply(std::vector<Vector<R, NumericT>> & result, const BlockSparseMatrix<R, C, NumericT> & left, const std::vector<Vector<C, NumericT>> & right, std::size_t grain = 256, Executor & executor = default_executor())
+		{
+			assert(left.rows() == result.size() && left.columns() == right.size());
+
+			multiply(result.data(), left, right.data(), grain, executor);
+		}
+
+		/// Run a transposed multiply which scatters into result. The rows are split into one range per thread, each of which accumulates into a private buffer, and the buffers are then summed into the result in order.
+		template <typename ValueT, typename FunctionT>
+		void scatter(ValueT * result, std::size_t size, std::size_t rows, const FunctionT & function, Executor & executor)
+		{
+			std::size_t count = std::min(executor.concurrency(), rows);
+
+			if (count <= 1) {
+				function(result, 0, rows);
+				return;
+			}
+
+			std::vector<ValueT, AlignedAllocator<ValueT>> buffers(count * size, ValueT(ZERO));
+
+			executor.run(count, [&](std::size_t i) {
+				function(buffers.data() + i * size, rows * i / count, rows * (i + 1) / count);
+			});
+
+			parallel_for(0, size, GRAIN, [&](std::size_t begin, std::size_t end) {
+				for (std::size_t i = 0; i < count; i += 1) {
+					const ValueT * buffer = buffers.data() + i * size;
+
+					for (std::size_t j = begin; j < end; j += 1)
+						result[j] += buffer[j];
+				}
+			}, executor);
+		}
+
+		/// Transposed sparse matrix-vector multiply, result += transpose(left) * right.
+		template <typename NumericT>
+		void multiply_transpose(DynamicVector<NumericT> & result, const SparseMatrix<NumericT> & left, const DynamicVector<NumericT> & right, Executor & executor = default_executor())
+		{
+			assert(left.columns() == result.size() && left.rows() == right.size());
+
+			scatter(result.data(), result.size(), left.rows(), [&](NumericT * output, std::size_t begin, std::size_t end) {
+				Numerics::multiply_transpose(output, left, right.data(), begin, end);
+			}, executor);
+		}
+
+		/// Transposed block sparse matrix-vector multiply, result += transpose(left) * right.
+		template <std::size_t R, std::size_t C, typename NumericT>
+		void multiply_transpose(std::vector<Vector<C, NumericT>> & result, const BlockSparseMatrix<R, C, NumericT> & left, const std::vector<Vector<R, NumericT>> & right, Executor & executor = default_executor())
+		{
+			assert(left.columns() == result.size() && left.rows() == right.size());
+
+			scatter(result.data(), result.size(), left.rows(), [&](Vector<C, NumericT> * output, std::size_t begin, std::size_t end) {
+				Numerics::multiply_transpose(output, left, right.data(), begin, end);
+			}, executor);
+		}
+	}
+}
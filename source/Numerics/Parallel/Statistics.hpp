@@ -0,0 +1,42 @@
+//
+//  Statistics.hpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "../Parallel.hpp"
+#include "../Statistics.hpp"
+
+#include <vector>
+
+namespace Numerics
+{
+	namespace Parallel
+	{
+		/// The statistics of an array of samples, with each chunk of grain samples reduced by its own accumulator. Partial results are always computed per grain and merged in order, so the result doesn't depend on the executor.
+		template <std::size_t D, typename NumericT>
+		Numerics::Statistics<D, NumericT> statistics(const Vector<D, NumericT> * values, std::size_t count, std::size_t grain = GRAIN, Executor & executor = default_executor())
+		{
+			grain = std::max<std::size_t>(grain, 1);
+
+			std::vector<Numerics::Statistics<D, NumericT>> partials((count + grain - 1) / grain);
+
+			executor.run(partials.size(), [&](std::size_t chunk) {
+				std::size_t begin = chunk * grain, end = std::min(begin + grain, count);
+
+				partials[chunk].add(values + begin, end - begin);
+			});
+
+			Numerics::Statistics<D, NumericT> result;
+
+			for (const auto & partial : partials)
+				result.merge(partial);
+
+			return result;
+		}
+	}
+}
@@ -0,0 +1,211 @@
+//
+//  ThreadPool.cpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "ThreadPool.hpp"
+
+#include <exception>
+
+namespace Numerics
+{
+	namespace Parallel
+	{
+		struct ThreadPool::Job {
+			const std::function<void(std::size_t)> & task;
+			std::size_t remaining;
+
+			std::mutex mutex;
+			std::condition_variable completed;
+			std::exception_ptr exception;
+
+			Job(const std::function<void(std::size_t)> & task_, std::size_t count) : task(task_), remaining(count) {}
+		};
+
+		namespace {
+			// The pool and queue index of the current worker thread, if any:
+			thread_local const ThreadPool * current_pool = nullptr;
+			thread_local std::size_t current_index = 0;
+		}
+
+		ThreadPool::ThreadPool(std::size_t workers) : _pending(0), _next_queue(0)
+		{
+			for (std::size_t i = 0; i < workers; i += 1)
+				_queues.emplace_back(new Queue);
+
+			for (std::size_t i = 0; i < workers; i += 1)
+				_threads.emplace_back(&ThreadPool::work, this, i);
+		}
+
+		ThreadPool::~ThreadPool()
+		{
+			{
+				std::lock_guard<std::mutex> lock(_mutex);
+				_stopping = true;
+			}
+
+			_wake.notify_all();
+
+			for (auto & thread : _threads)
+				thread.join();
+		}
+
+		ThreadPool & ThreadPool::shared()
+		{
+			static ThreadPool pool;
+
+			return pool;
+		}
+
+		std::size_t ThreadPool::default_workers() noexcept
+		{
+			auto hardware = std::thread::hardware_concurrency();
+
+			return hardware > 1 ? hardware - 1 : 0;
+		}
+
+		std::size_t ThreadPool::concurrency() const noexcept
+		{
+			return _threads.size() + 1;
+		}
+
+		void ThreadPool::run(std::size_t count, const std::function<void(std::size_t)> & task)
+		{
+			if (count == 0) return;
+
+			if (_threads.empty() || count == 1) {
+				for (std::size_t i = 0; i < count; i += 1)
+					task(i);
+
+				return;
+			}
+
+			Job job(task, count);
+
+			bool owner = (current_pool == this);
+			std::size_t queue_count = _queues.size();
+			std::size_t first = owner ? current_index : (_next_queue++ % queue_count);
+
+			// Each queue receives a contiguous range of indices, so that neighbouring tasks tend to run on the same thread:
+			for (std::size_t q = 0; q < queue_count; q += 1) {
+				std::size_t begin = count * q / queue_count, end = count * (q + 1) / queue_count;
+
+				if (begin == end) continue;
+
+				auto & queue = *_queues[(first + q) % queue_count];
+				std::lock_guard<std::mutex> lock(queue.mutex);
+
+				for (std::size_t i = begin; i < end; i += 1)
+					queue.tasks.push_back(Task{&job, i});
+			}
+
+			{
+				std::lock_guard<std::mutex> lock(_mutex);
+				_pending += count;
+			}
+
+			_wake.notify_all();
+
+			// Help with outstanding work until this batch is complete:
+			while (true) {
+				{
+					std::lock_guard<std::mutex> lock(job.mutex);
+					if (job.remaining == 0) break;
+				}
+
+				Task next;
+
+				if (acquire(next, owner ? current_index : first, owner)) {
+					execute(next);
+				} else {
+					std::unique_lock<std::mutex> lock(job.mutex);
+					job.completed.wait(lock, [&]{return job.remaining == 0;});
+
+					break;
+				}
+			}
+
+			// The job is only released once its last task has finished with the mutex:
+			std::lock_guard<std::mutex> lock(job.mutex);
+
+			if (job.exception)
+				std::rethrow_exception(job.exception);
+		}
+
+		void ThreadPool::work(std::size_t index)
+		{
+			current_pool = this;
+			current_index = index;
+
+			while (true) {
+				Task task;
+
+				if (acquire(task, index, true)) {
+					execute(task);
+				} else {
+					std::unique_lock<std::mutex> lock(_mutex);
+					_wake.wait(lock, [&]{return _stopping || _pending > 0;});
+
+					if (_stopping && _pending <= 0) return;
+				}
+			}
+		}
+
+		bool ThreadPool::acquire(Task & task, std::size_t index, bool owner)
+		{
+			std::size_t queue_count = _queues.size();
+
+			// Take the most recently queued task from our own queue, as it is most likely to be in cache:
+			if (owner) {
+				auto & queue = *_queues[index];
+				std::lock_guard<std::mutex> lock(queue.mutex);
+
+				if (!queue.tasks.empty()) {
+					task = queue.tasks.back();
+					queue.tasks.pop_back();
+					_pending -= 1;
+
+					return true;
+				}
+			}
+
+			// Otherwise steal the oldest task from another queue:
+			for (std::size_t i = owner ? 1 : 0; i < queue_count; i += 1) {
+				auto & queue = *_queues[(index + i) % queue_count];
+				std::lock_guard<std::mutex> lock(queue.mutex);
+
+				if (!queue.tasks.empty()) {
+					task = queue.tasks.front();
+					queue.tasks.pop_front();
+					_pending -= 1;
+
+					return true;
+				}
+			}
+
+			return false;
+		}
+
+		void ThreadPool::execute(const Task & task)
+		{
+			Job & job = *task.job;
+
+			try {
+				job.task(task.index);
+			} catch (...) {
+				std::lock_guard<std::mutex> lock(job.mutex);
+
+				if (!job.exception)
+					job.exception = std::current_exception();
+			}
+
+			std::lock_guard<std::mutex> lock(job.mutex);
+
+			if (--job.remaining == 0)
+				job.completed.notify_all();
+		}
+	}
+}
@@ -0,0 +1,76 @@
+//
+//  ThreadPool.hpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "../Parallel.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Numerics
+{
+	namespace Parallel
+	{
+		/// A work-stealing thread pool.
+		/// Each worker has its own queue, which it drains from the back. Idle workers steal from the front of other queues, so that large contiguous runs of work migrate between threads. The thread which calls run() also executes tasks until its batch is complete, which makes nested parallelism safe.
+		class ThreadPool final : public Executor
+		{
+		public:
+			/// Create a pool with the given number of background threads. The calling thread always participates, so the concurrency is workers + 1.
+			explicit ThreadPool(std::size_t workers = default_workers());
+			virtual ~ThreadPool();
+
+			ThreadPool(const ThreadPool &) = delete;
+			ThreadPool & operator=(const ThreadPool &) = delete;
+
+			/// A pool shared by the entire process, created on first use.
+			static ThreadPool & shared();
+
+			/// One less than the hardware concurrency, since the calling thread also does work.
+			static std::size_t default_workers() noexcept;
+
+			std::size_t concurrency() const noexcept override;
+			void run(std::size_t count, const std::function<void(std::size_t)> & task) override;
+
+		private:
+			struct Job;
+
+			struct Task {
+				Job * job;
+				std::size_t index;
+			};
+
+			struct Queue {
+				std::mutex mutex;
+				std::deque<Task> tasks;
+			};
+
+			std::vector<std::unique_ptr<Queue>> _queues;
+			std::vector<std::thread> _threads;
+
+			// The number of tasks waiting in all queues. It is signed because a task may be taken before its submission has been counted.
+			std::atomic<std::ptrdiff_t> _pending;
+			std::atomic<std::size_t> _next_queue;
+
+			std::mutex _mutex;
+			std::condition_variable _wake;
+			bool _stopping = false;
+
+			void work(std::size_t index);
+
+			bool acquire(Task & task, std::size_t index, bool owner);
+			void execute(const Task & task);
+		};
+	}
+}
@@ -0,0 +1,15 @@
+//
+//  Polynomial.cpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Polynomial.hpp"
+
+namespace Numerics
+{
+	template struct Polynomial<4, float, float>;
+	template struct Polynomial<4, Vector<3, float>, float>;
+}
@@ -0,0 +1,176 @@
+//
+//  Polynomial.hpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "Vector.hpp"
+
+#include <algorithm>
+
+#include "Polynomial/SSE.hpp"
+
+namespace Numerics
+{
+	/// Evaluate a polynomial at each of the given values of t using Horner's method.
+	template <std::size_t N, typename CoefficientT, typename ParameterT>
+	void horner(const CoefficientT (&coefficients)[N], std::size_t count, const ParameterT * t, CoefficientT * result)
+	{
+		for (std::size_t i = 0; i < count; i += 1) {
+			CoefficientT value = coefficients[N-1];
+
+			for (std::size_t j = N-1; j-- > 0;)
+				value = value * t[i] + coefficients[j];
+
+			result[i] = value;
+		}
+	}
+
+#ifdef NUMERICS_POLYNOMIAL_SSE
+	template <std::size_t N>
+	void horner(const float (&coefficients)[N], std::size_t count, const float * t, float * result)
+	{
+		horner(coefficients, N, count, t, result, 1);
+	}
+
+	/// Each component is evaluated separately, four values of t at a time, and stored with a stride of D.
+	template <std::size_t N, std::size_t D>
+	void horner(const Vector<D, float> (&coefficients)[N], std::size_t count, const float * t, Vector<D, float> * result)
+	{
+		static_assert(sizeof(Vector<D, float>) == sizeof(float) * D, "Vector must be tightly packed!");
+
+		for (std::size_t d = 0; d < D; d += 1) {
+			float component[N];
+
+			for (std::size_t i = 0; i < N; i += 1)
+				component[i] = coefficients[i][d];
+
+			horner(component, N, count, t, reinterpret_cast<float *>(result) + d, D);
+		}
+	}
+#endif
+
+	/// A polynomial of degree N-1 in the power basis, c[0] + c[1] t + ... + c[N-1] t^(N-1). The coefficients may be scalars or vectors, and t has type ParameterT. Interpolation bases such as Hermite and Bézier are converted once, so that evaluating them doesn't recompute the basis weights for every t.
+	template <std::size_t N, typename CoefficientT, typename ParameterT = RealT>
+	struct Polynomial
+	{
+		static_assert(N > 0, "Polynomial must have at least one coefficient!");
+
+		CoefficientT coefficients[N];
+
+		/// The polynomial equivalent to Interpolate::linear.
+		template <std::size_t M = N>
+		static Polynomial linear(const CoefficientT & a, const CoefficientT & b)
+		{
+			static_assert(M == 2, "Linear interpolation has two coefficients!");
+
+			return {{a, b - a}};
+		}
+
+		/// The polynomial equivalent to Interpolate::cubic.
+		template <std::size_t M = N>
+		static Polynomial cubic(const CoefficientT & a, const CoefficientT & b, const CoefficientT & c, const CoefficientT & d)
+		{
+			static_assert(M == 4, "Cubic interpolation has four coefficients!");
+
+			CoefficientT p = (d - c) - (a - b);
+
+			return {{b, c - a, (a - b) - p, p}};
+		}
+
+		/// The polynomial equivalent to Interpolate::hermite, from p0 to p1 with tangents m0 and m1.
+		template <std::size_t M = N>
+		static Polynomial hermite(const CoefficientT & p0, const CoefficientT & m0, const CoefficientT & p1, const CoefficientT & m1)
+		{
+			static_assert(M == 4, "Hermite interpolation has four coefficients!");
+
+			return {{p0, m0, (p1 - p0) * 3 - m0 * 2 - m1, (p0 - p1) * 2 + m0 + m1}};
+		}
+
+		/// The cubic Bézier curve from p0 to p3 with control points p1 and p2.
+		template <std::size_t M = N>
+		static Polynomial bezier(const CoefficientT & p0, const CoefficientT & p1, const CoefficientT & p2, const CoefficientT & p3)
+		{
+			static_assert(M == 4, "Cubic Bézier curves have four coefficients!");
+
+			return {{p0, (p1 - p0) * 3, (p0 - p1 * 2 + p2) * 3, (p1 - p2) * 3 + p3 - p0}};
+		}
+
+		/// Evaluate at t using Horner's method.
+		CoefficientT operator()(const ParameterT & t) const
+		{
+			CoefficientT result = coefficients[N-1];
+
+			for (std::size_t i = N-1; i-- > 0;)
+				result = result * t + coefficients[i];
+
+			return result;
+		}
+
+		template <std::size_t M = N>
+		Polynomial<M-1, CoefficientT, ParameterT> derivative() const
+		{
+			static_assert(M > 1, "Constant polynomial has no derivative!");
+
+			Polynomial<M-1, CoefficientT, ParameterT> result;
+
+			for (std::size_t i = 1; i < N; i += 1)
+				result.coefficients[i-1] = coefficients[i] * ParameterT(i);
+
+			return result;
+		}
+
+		/// Evaluate at each of the given values of t, using SIMD where available.
+		void evaluate(std::size_t count, const ParameterT * t, CoefficientT * result) const
+		{
+			horner(coefficients, count, t, result);
+		}
+
+		/// Evaluate at the uniformly spaced values start + i * step by forward differencing, which takes N-1 additions per sample. Rounding errors accumulate with the number of samples, so very long runs should be split.
+		void evaluate_uniform(std::size_t count, const ParameterT & start, const ParameterT & step, CoefficientT * result) const
+		{
+			// The coefficients of q(s) = p(start + step * s), by a Taylor shift and then scaling:
+			CoefficientT shifted[N];
+			std::copy(coefficients, coefficients + N, shifted);
+
+			for (std::size_t i = 0; i + 1 < N; i += 1)
+				for (std::size_t j = N-1; j-- > i;)
+					shifted[j] = shifted[j] + shifted[j+1] * start;
+
+			ParameterT scale = step;
+			for (std::size_t j = 1; j < N; j += 1, scale *= step)
+				shifted[j] = shifted[j] * scale;
+
+			// The k-th forward difference of s^j at s = 0 is the number of surjections from j elements onto k, which avoids computing the differences from nearly equal samples:
+			ParameterT surjections[N][N] = {};
+			surjections[0][0] = 1;
+
+			for (std::size_t j = 1; j < N; j += 1)
+				for (std::size_t k = 1; k <= j; k += 1)
+					surjections[j][k] = ParameterT(k) * (surjections[j-1][k] + surjections[j-1][k-1]);
+
+			CoefficientT differences[N];
+
+			for (std::size_t k = 0; k < N; k += 1) {
+				differences[k] = shifted[k] * surjections[k][k];
+
+				for (std::size_t j = k + 1; j < N; j += 1)
+					differences[k] = differences[k] + shifted[j] * surjections[j][k];
+			}
+
+			for (std::size_t i = 0; i < count; i += 1) {
+				result[i] = differences[0];
+
+				for (std::size_t j = 0; j + 1 < N; j += 1)
+					differences[j] = differences[j] + differences[j+1];
+			}
+		}
+	};
+
+	extern template struct Polynomial<4, float, float>;
+	extern template struct Polynomial<4, Vector<3, float>, float>;
+}
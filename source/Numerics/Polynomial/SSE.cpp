@@ -0,0 +1,50 @@
+//
+//  SSE.cpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "SSE.hpp"
+
+#ifdef NUMERICS_POLYNOMIAL_SSE
+
+#include <xmmintrin.h>
+
+namespace Numerics
+{
+	void horner(const float * coefficients, std::size_t size, std::size_t count, const float * t, float * result, std::size_t stride)
+	{
+		std::size_t i = 0;
+
+		for (; i + 4 <= count; i += 4) {
+			__m128 x = _mm_loadu_ps(t + i);
+			__m128 value = _mm_set1_ps(coefficients[size-1]);
+
+			for (std::size_t j = size-1; j-- > 0;)
+				value = _mm_add_ps(_mm_mul_ps(value, x), _mm_set1_ps(coefficients[j]));
+
+			if (stride == 1) {
+				_mm_storeu_ps(result + i, value);
+			} else {
+				float lanes[4];
+				_mm_storeu_ps(lanes, value);
+
+				for (std::size_t k = 0; k < 4; k += 1)
+					result[(i + k) * stride] = lanes[k];
+			}
+		}
+
+		for (; i < count; i += 1) {
+			float value = coefficients[size-1];
+
+			for (std::size_t j = size-1; j-- > 0;)
+				value = value * t[i] + coefficients[j];
+
+			result[i * stride] = value;
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,23 @@
+//
+//  SSE.hpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#ifdef __SSE2__
+
+#define NUMERICS_POLYNOMIAL_SSE
+
+#include <cstddef>
+
+namespace Numerics
+{
+	// Evaluate the polynomial with the given coefficients (lowest power first) at four values of t at a time, using Horner's method. Results are stored with the given stride:
+	void horner(const float * coefficients, std::size_t size, std::size_t count, const float * t, float * result, std::size_t stride);
+}
+
+#endif
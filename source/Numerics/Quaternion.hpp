@@ -16,6 +16,37 @@ namespace Numerics
 	template <std::size_t R, std::size_t C, typename NumericT>
 	class Matrix;
 	
+	/// Compute the quaternion for the rotation given by an orthonormal basis, where x, y and z are the columns of the rotation matrix.
+	/// This uses Shepperd's method: the largest of 4w², 4x², 4y² and 4z² is computed from the diagonal and the other components are found by dividing the off-diagonal sums and differences by it, so the divisor is never small. The selection is written as conditional expressions so that it can be compiled without branches.
+	template <typename NumericT>
+	Vector<4, NumericT> rotation_from_basis(const NumericT * x, const NumericT * y, const NumericT * z)
+	{
+		const NumericT m00 = x[0], m10 = x[1], m20 = x[2];
+		const NumericT m01 = y[0], m11 = y[1], m21 = y[2];
+		const NumericT m02 = z[0], m12 = z[1], m22 = z[2];
+
+		const NumericT tw = 1 + m00 + m11 + m22, tx = 1 + m00 - m11 - m22, ty = 1 - m00 + m11 - m22, tz = 1 - m00 - m11 + m22;
+		const NumericT a = m21 - m12, b = m02 - m20, c = m10 - m01, d = m01 + m10, e = m02 + m20, f = m12 + m21;
+
+		// Each case gives (x, y, z, w) scaled by four times the selected component:
+		NumericT best = tw, qx = a, qy = b, qz = c, qw = tw;
+		bool select;
+
+		select = tx > best;
+		best = select ? tx : best; qx = select ? tx : qx; qy = select ? d : qy; qz = select ? e : qz; qw = select ? a : qw;
+
+		select = ty > best;
+		best = select ? ty : best; qx = select ? d : qx; qy = select ? ty : qy; qz = select ? f : qz; qw = select ? b : qw;
+
+		select = tz > best;
+		best = select ? tz : best; qx = select ? e : qx; qy = select ? f : qy; qz = select ? tz : qz; qw = select ? c : qw;
+
+		using std::sqrt;
+		const NumericT k = NumericT(0.5) / sqrt(best);
+
+		return {qx * k, qy * k, qz * k, qw * k};
+	}
+
 	// An efficient representation of an angle/axis rotation in 3D.
 	template <typename NumericT = RealT>
 	class Quaternion : public Vector<4, NumericT> {
@@ -28,24 +59,22 @@ namespace Numerics
 
 		Quaternion(const Vector<4, NumericT> & value) : Vector<4, NumericT>(value) {}
 		
-		// Quaternion(const Matrix<4, 4, NumericT> & m)
-		// {
-		// 	auto w = number(1.0 + m[0] + m[5] + m[10]).sqrt() / 2;
-		// 
-		// 	(*this)[X] = (m[6] - m[9]) / (4 * w);
-		// 	(*this)[Y] = (m[8] - m[2]) / (4 * w);
-		// 	(*this)[Z] = (m[1] - m[4]) / (4 * w);
-		// 	(*this)[W] = w;
-		// 	
-		// 	this->normalize(this->length(), 1.0);
-		// }
+		/// Extract the rotation from the upper 3x3 of an orthonormal matrix.
+		template <std::size_t R, std::size_t C>
+		explicit Quaternion(const Matrix<R, C, NumericT> & m) : Vector<4, NumericT>(rotation_from_basis(m.data(), m.data() + R, m.data() + R*2))
+		{
+			static_assert(R >= 3 && C >= 3, "Matrix must be at least 3x3 to contain rotation!");
+		}
 
 		/// Angle axis constructor.
 		Quaternion(const Radians<NumericT> & angle, const Vector<3, NumericT> & axis)
 		{
 			auto half_angle = angle / 2.0;
-			
-			(*this) = (axis * half_angle.sin()).append(half_angle.cos());
+
+			NumericT s, c;
+			half_angle.sin_cos(s, c);
+
+			(*this) = (axis * s).append(c);
 		}
 		
 		template <std::size_t N, typename AngleNumericT, typename AxisNumericT>
@@ -111,15 +140,9 @@ namespace Numerics
 		
 		Quaternion operator*(const Quaternion & other) const noexcept
 		{
-			auto & q1 = *this;
-			auto & q2 = other;
-			
 			Quaternion result;
 
-			result[X] = (q1[W]*q2[X] + q1[X]*q2[W] + q1[Y]*q2[Z]) - q1[Z]*q2[Y];
-			result[Y] = (q1[W]*q2[Y] + q1[Y]*q2[W] + q1[Z]*q2[X]) - q1[X]*q2[Z];
-			result[Z] = (q1[W]*q2[Z] + q1[X]*q2[Y] + q1[Z]*q2[W]) - q1[Y]*q2[X];
-			result[W] =  q1[W]*q2[W] - q1[X]*q2[X] - q1[Y]*q2[Y]  - q1[Z]*q2[Z];
+			multiply(result, *this, other);
 
 			return result;
 		}
@@ -130,6 +153,25 @@ namespace Numerics
 		}
 	};
 	
+	/// Many quaternions stored as one array per component (structure of arrays), so that each SIMD lane can operate on a different quaternion. Use a const NumericT for read-only arrays.
+	template <typename NumericT>
+	struct QuaternionArrays
+	{
+		typedef QuaternionArrays<const NumericT> ConstT;
+
+		NumericT * x;
+		NumericT * y;
+		NumericT * z;
+		NumericT * w;
+
+		/// Mutable arrays can be used where read-only arrays are expected.
+		template <typename OtherT, typename = std::enable_if_t<std::is_same<OtherT, const NumericT>::value && !std::is_const<NumericT>::value>>
+		operator QuaternionArrays<OtherT>() const
+		{
+			return {x, y, z, w};
+		}
+	};
+
 	namespace Interpolate
 	{
 		/// Spherical linear interpolation is typically used to interpolate between rotations represented in quaternion space.
@@ -152,13 +194,21 @@ namespace Numerics
 			// theta = angle between v0 and result:
 			auto theta = theta_0 * t;
 
-			auto q2 = (q1 - q0 * dot).normalize();
+			// Quaternion::operator* is the rotation product, so scale q0 as a vector:
+			const Vector<4, NumericT> & v0 = q0;
+
+			auto q2 = (q1 - v0 * dot).normalize();
 
 			// { q0, q2 } is now an orthonormal basis.
-			return q0*cos(theta) + q2*sin(theta);
+			return v0*theta.cos() + q2*theta.sin();
 		}
 	}
 	
 	extern template class Quaternion<float>;
 	extern template class Quaternion<double>;
 }
+
+#include "Quaternion/Multiply.hpp"
+#include "Quaternion/Convert.hpp"
+#include "Quaternion/Interpolate.hpp"
+#include "Quaternion/Compress.hpp"
@@ -0,0 +1,114 @@
+//
+//  Compress.hpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "../Quaternion.hpp"
+#include "../Integer.hpp"
+
+#include "SSE.hpp"
+
+#include <cstdint>
+#include <cmath>
+#include <algorithm>
+
+namespace Numerics
+{
+	/**
+	 * Compresses unit quaternions using the "smallest three" encoding. Since q and -q are the same rotation, the sign is chosen to make the largest component positive, which then doesn't need to be stored as it can be recovered from the unit length. The other three components lie in [-1/sqrt(2), 1/sqrt(2)] and are quantized to BITS each, along with 2 bits for the index of the largest component.
+	 *
+	 * Each stored component is within e = 1/(sqrt(2) (2^BITS - 1)) of its true value. As the largest component is at least 1/2 and at least as large as the others, its recovered value is within 3e, so the decoded quaternion is within sqrt(12) e and the rotation angle between them is at most 4 sqrt(3) e = 2 sqrt(6) / (2^BITS - 1). This is 0.0048 radians (0.28 degrees) for 10 bits, 0.00015 radians for 15 bits and 0.0000047 radians for 20 bits.
+	 */
+	template <std::size_t BITS, typename StorageT>
+	struct SmallestThree
+	{
+		static_assert(BITS * 3 + 2 <= sizeof(StorageT) * 8, "Storage is too small for the number of bits!");
+
+		enum : std::uint64_t {
+			MAXIMUM = (std::uint64_t(1) << BITS) - 1
+		};
+
+		/// The maximum angle in radians between the rotation of a unit quaternion and its decoded value.
+		static float maximum_angular_error()
+		{
+			return 2 * std::sqrt(6.0f) / MAXIMUM;
+		}
+
+		static StorageT encode(const Quaternion<float> & rotation)
+		{
+			std::size_t largest = 0;
+
+			for (std::size_t i = 1; i < 4; i += 1)
+				if (std::abs(rotation[i]) > std::abs(rotation[largest])) largest = i;
+
+			const float sign = rotation[largest] < 0 ? -1 : 1;
+			std::uint64_t value = std::uint64_t(largest) << (BITS * 3), shift = BITS * 3;
+
+			for (std::size_t i = 0; i < 4; i += 1) {
+				if (i == largest) continue;
+
+				// Map [-1/sqrt(2), 1/sqrt(2)] to [0, MAXIMUM]:
+				float scaled = (rotation[i] * sign * float(M_SQRT2) + 1) * (MAXIMUM * 0.5f);
+
+				shift -= BITS;
+				value |= std::uint64_t(std::lrint(std::min(std::max(scaled, 0.0f), float(MAXIMUM)))) << shift;
+			}
+
+			return StorageT(value);
+		}
+
+		static Quaternion<float> decode(const StorageT & encoded)
+		{
+			const std::uint64_t value = encoded;
+			const std::size_t largest = (value >> (BITS * 3)) & 3;
+
+			Quaternion<float> rotation;
+			std::uint64_t shift = BITS * 3;
+			float sum = 0;
+
+			for (std::size_t i = 0; i < 4; i += 1) {
+				if (i == largest) continue;
+
+				shift -= BITS;
+				rotation[i] = float((value >> shift) & MAXIMUM) * float(M_SQRT2 / MAXIMUM) - float(M_SQRT1_2);
+				sum += rotation[i] * rotation[i];
+			}
+
+			rotation[largest] = std::sqrt(std::max(1 - sum, 0.0f));
+
+			return rotation;
+		}
+
+		static void encode(StorageT * result, const Quaternion<float> * source, std::size_t count)
+		{
+			for (std::size_t i = 0; i < count; i += 1)
+				result[i] = encode(source[i]);
+		}
+
+		static void decode(Quaternion<float> * result, const StorageT * source, std::size_t count)
+		{
+			for (std::size_t i = 0; i < count; i += 1)
+				result[i] = decode(source[i]);
+		}
+	};
+
+	/// Three 10-bit components and a 2-bit index: 4 bytes instead of 16.
+	typedef SmallestThree<10, std::uint32_t> SmallestThree32;
+
+	/// Three 15-bit components and a 2-bit index: 6 bytes.
+	typedef SmallestThree<15, UInt48> SmallestThree48;
+
+	/// Three 20-bit components and a 2-bit index: 8 bytes.
+	typedef SmallestThree<20, std::uint64_t> SmallestThree64;
+
+#ifdef NUMERICS_QUATERNION_SSE
+	// These are optimised specializations for SSE2, which process four quaternions at a time:
+	template <> void SmallestThree<10, std::uint32_t>::encode(std::uint32_t * result, const Quaternion<float> * source, std::size_t count);
+	template <> void SmallestThree<10, std::uint32_t>::decode(Quaternion<float> * result, const std::uint32_t * source, std::size_t count);
+#endif
+}
@@ -0,0 +1,33 @@
+//
+//  Convert.hpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "../Quaternion.hpp"
+#include "../Matrix.hpp"
+
+#include "SSE.hpp"
+
+namespace Numerics
+{
+	/// Extract the rotations from an array of orthonormal matrices.
+	template <std::size_t R, std::size_t C, typename NumericT>
+	void convert(Quaternion<NumericT> * result, const Matrix<R, C, NumericT> * source, std::size_t count)
+	{
+		for (std::size_t i = 0; i < count; i += 1)
+			result[i] = Quaternion<NumericT>(source[i]);
+	}
+
+	/// Convert an array of unit quaternions to rotation matrices.
+	template <std::size_t R, std::size_t C, typename NumericT>
+	void convert(Matrix<R, C, NumericT> * result, const Quaternion<NumericT> * source, std::size_t count)
+	{
+		for (std::size_t i = 0; i < count; i += 1)
+			result[i] = Matrix<R, C, NumericT>(source[i]);
+	}
+}
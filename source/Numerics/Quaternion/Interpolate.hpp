@@ -0,0 +1,108 @@
+//
+//  Interpolate.hpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "../Quaternion.hpp"
+
+#include "SSE.hpp"
+
+namespace Numerics
+{
+	namespace Interpolate
+	{
+		/// Spherical linear interpolation of arrays of rotations, each pair with its own t. Unlike spherical_linear, q1 is negated when required so that the interpolation takes the shorter path.
+		template <typename NumericT>
+		void spherical_linear(std::size_t count, const NumericT * t, typename QuaternionArrays<NumericT>::ConstT q0, typename QuaternionArrays<NumericT>::ConstT q1, QuaternionArrays<NumericT> result)
+		{
+			const NumericT DOT_THRESHOLD = 0.9995;
+
+			for (std::size_t i = 0; i < count; i += 1) {
+				NumericT dot = q0.x[i] * q1.x[i] + q0.y[i] * q1.y[i] + q0.z[i] * q1.z[i] + q0.w[i] * q1.w[i];
+				NumericT sign = dot < 0 ? -1 : 1;
+				dot *= sign;
+
+				NumericT a, b;
+
+				if (dot > DOT_THRESHOLD) {
+					// Linearly interpolate, and normalize the result below:
+					a = 1 - t[i];
+					b = t[i];
+				} else {
+					NumericT theta = std::acos(dot), sin_theta = std::sqrt(1 - dot * dot);
+
+					a = std::sin((1 - t[i]) * theta) / sin_theta;
+					b = std::sin(t[i] * theta) / sin_theta;
+				}
+
+				b *= sign;
+
+				NumericT x = q0.x[i] * a + q1.x[i] * b, y = q0.y[i] * a + q1.y[i] * b, z = q0.z[i] * a + q1.z[i] * b, w = q0.w[i] * a + q1.w[i] * b;
+
+				if (dot > DOT_THRESHOLD) {
+					NumericT scale = 1 / std::sqrt(x * x + y * y + z * z + w * w);
+
+					x *= scale; y *= scale; z *= scale; w *= scale;
+				}
+
+				result.x[i] = x; result.y[i] = y; result.z[i] = z; result.w[i] = w;
+			}
+		}
+
+		/// The weight given to one end point when spherically interpolating by t between unit quaternions separated by angle theta, i.e. sin(t theta) / sin(theta), given x = cos(theta) - 1.
+		/// This is the polynomial approximation by David Eberly ("A Fast and Accurate Algorithm for Computing SLERP"): the series expansion in x is truncated to 8 terms, and the last term is scaled by 1 + mu to compensate. It uses only multiplies and adds, so it vectorises without branches.
+		/// For 0 <= theta <= pi/2 (i.e. taking the shorter path) and 0 <= t <= 1 the absolute error is less than 2e-5.
+		template <typename NumericT>
+		inline NumericT spherical_linear_weight(NumericT t, NumericT x)
+		{
+			const NumericT MU = 1.85298109240830;
+
+			// u[i] = 1 / (i (2i + 1)) and v[i] = i / (2i + 1), for i = 1 ... 8:
+			const NumericT u[8] = {1.0/3, 1.0/10, 1.0/21, 1.0/36, 1.0/55, 1.0/78, 1.0/105, MU/136};
+			const NumericT v[8] = {1.0/3, 2.0/5, 3.0/7, 4.0/9, 5.0/11, 6.0/13, 7.0/15, MU*8/17};
+
+			NumericT t2 = t * t, r = 1;
+
+			for (std::size_t i = 8; i-- > 0;)
+				r = 1 + (u[i] * t2 - v[i]) * x * r;
+
+			return t * r;
+		}
+
+		/// Approximate spherical linear interpolation, taking the shorter path. Each component of the result differs from the exact interpolation by less than 4e-5 (plus rounding error), and the result is not renormalized.
+		template <typename NumericT>
+		Quaternion<NumericT> fast_spherical_linear(NumericT t, const Quaternion<NumericT> & q0, const Quaternion<NumericT> & q1)
+		{
+			NumericT dot = q0.dot(q1);
+			NumericT sign = dot < 0 ? -1 : 1;
+			NumericT x = dot * sign - 1;
+
+			const Vector<4, NumericT> & v0 = q0, & v1 = q1;
+
+			return v0 * spherical_linear_weight(1 - t, x) + v1 * (spherical_linear_weight(t, x) * sign);
+		}
+
+		/// Approximate spherical linear interpolation of arrays of rotations, each pair with its own t. See fast_spherical_linear above for the error bound.
+		template <typename NumericT>
+		void fast_spherical_linear(std::size_t count, const NumericT * t, typename QuaternionArrays<NumericT>::ConstT q0, typename QuaternionArrays<NumericT>::ConstT q1, QuaternionArrays<NumericT> result)
+		{
+			for (std::size_t i = 0; i < count; i += 1) {
+				NumericT dot = q0.x[i] * q1.x[i] + q0.y[i] * q1.y[i] + q0.z[i] * q1.z[i] + q0.w[i] * q1.w[i];
+				NumericT sign = dot < 0 ? -1 : 1;
+				NumericT x = dot * sign - 1;
+
+				NumericT a = spherical_linear_weight(1 - t[i], x), b = spherical_linear_weight(t[i], x) * sign;
+
+				result.x[i] = q0.x[i] * a + q1.x[i] * b;
+				result.y[i] = q0.y[i] * a + q1.y[i] * b;
+				result.z[i] = q0.z[i] * a + q1.z[i] * b;
+				result.w[i] = q0.w[i] * a + q1.w[i] * b;
+			}
+		}
+	}
+}
@@ -0,0 +1,53 @@
+//
+//  Multiply.hpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "../Quaternion.hpp"
+
+#include "SSE.hpp"
+
+namespace Numerics
+{
+	/// The Hamilton product: result = left * right.
+	template <typename NumericT>
+	void multiply(Quaternion<NumericT> & result, const Quaternion<NumericT> & left, const Quaternion<NumericT> & right)
+	{
+		auto & q1 = left;
+		auto & q2 = right;
+
+		result[X] = (q1[W]*q2[X] + q1[X]*q2[W] + q1[Y]*q2[Z]) - q1[Z]*q2[Y];
+		result[Y] = (q1[W]*q2[Y] + q1[Y]*q2[W] + q1[Z]*q2[X]) - q1[X]*q2[Z];
+		result[Z] = (q1[W]*q2[Z] + q1[X]*q2[Y] + q1[Z]*q2[W]) - q1[Y]*q2[X];
+		result[W] =  q1[W]*q2[W] - q1[X]*q2[X] - q1[Y]*q2[Y]  - q1[Z]*q2[Z];
+	}
+
+	/// Multiply arrays of quaternions pairwise: result[i] = left[i] * right[i].
+	template <typename NumericT>
+	void multiply(Quaternion<NumericT> * result, const Quaternion<NumericT> * left, const Quaternion<NumericT> * right, std::size_t count)
+	{
+		for (std::size_t i = 0; i < count; i += 1)
+			multiply(result[i], left[i], right[i]);
+	}
+
+	/// Rotate an array of points, each by its own rotation: result[i] = left[i] * right[i].
+	template <typename NumericT>
+	void multiply(Vector<3, NumericT> * result, const Quaternion<NumericT> * left, const Vector<3, NumericT> * right, std::size_t count)
+	{
+		for (std::size_t i = 0; i < count; i += 1)
+			result[i] = left[i] * right[i];
+	}
+
+	/// Conjugate an array of quaternions, which inverts unit rotations.
+	template <typename NumericT>
+	void conjugate(Quaternion<NumericT> * result, const Quaternion<NumericT> * source, std::size_t count)
+	{
+		for (std::size_t i = 0; i < count; i += 1)
+			result[i] = source[i].conjugate();
+	}
+}
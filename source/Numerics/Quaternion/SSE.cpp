@@ -0,0 +1,443 @@
+//
+//  SSE.cpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "SSE.hpp"
+#include "Compress.hpp"
+#include "../Vector/SSE.hpp"
+
+#ifdef NUMERICS_QUATERNION_SSE
+
+#include <xmmintrin.h>
+#include <emmintrin.h>
+
+namespace Numerics
+{
+	namespace
+	{
+		inline __m128 select(__m128 mask, __m128 a, __m128 b)
+		{
+			return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+		}
+		
+		// Convert four matrices, using the same selection as rotation_from_basis in each lane:
+		template <std::size_t R>
+		void convert_4(Quaternion<float> * result, const Matrix<R, R, float> * source)
+		{
+			// Reading four elements from the start of the last column relies on the padding of Matrix<3, 3, float>:
+			static_assert(sizeof(Matrix<R, R, float>) >= sizeof(float) * (R*2 + 4), "Matrix is too small!");
+			
+			// Load the first three columns of each matrix, and transpose them so that m[c][r] holds element (r, c) of all four matrices:
+			__m128 m[3][4];
+			
+			for (std::size_t c = 0; c < 3; c += 1) {
+				m[c][0] = _mm_loadu_ps(source[0].data() + R*c);
+				m[c][1] = _mm_loadu_ps(source[1].data() + R*c);
+				m[c][2] = _mm_loadu_ps(source[2].data() + R*c);
+				m[c][3] = _mm_loadu_ps(source[3].data() + R*c);
+				
+				_MM_TRANSPOSE4_PS(m[c][0], m[c][1], m[c][2], m[c][3]);
+			}
+			
+			const __m128 one = _mm_set1_ps(1), half = _mm_set1_ps(0.5);
+			
+			__m128 tw = _mm_add_ps(_mm_add_ps(one, m[0][0]), _mm_add_ps(m[1][1], m[2][2]));
+			__m128 tx = _mm_sub_ps(_mm_add_ps(one, m[0][0]), _mm_add_ps(m[1][1], m[2][2]));
+			__m128 ty = _mm_sub_ps(_mm_add_ps(one, m[1][1]), _mm_add_ps(m[0][0], m[2][2]));
+			__m128 tz = _mm_sub_ps(_mm_add_ps(one, m[2][2]), _mm_add_ps(m[0][0], m[1][1]));
+			
+			__m128 a = _mm_sub_ps(m[1][2], m[2][1]), b = _mm_sub_ps(m[2][0], m[0][2]), c = _mm_sub_ps(m[0][1], m[1][0]);
+			__m128 d = _mm_add_ps(m[1][0], m[0][1]), e = _mm_add_ps(m[2][0], m[0][2]), f = _mm_add_ps(m[2][1], m[1][2]);
+			
+			__m128 best = tw, qx = a, qy = b, qz = c, qw = tw, mask;
+			
+			mask = _mm_cmpgt_ps(tx, best);
+			best = select(mask, tx, best); qx = select(mask, tx, qx); qy = select(mask, d, qy); qz = select(mask, e, qz); qw = select(mask, a, qw);
+			
+			mask = _mm_cmpgt_ps(ty, best);
+			best = select(mask, ty, best); qx = select(mask, d, qx); qy = select(mask, ty, qy); qz = select(mask, f, qz); qw = select(mask, b, qw);
+			
+			mask = _mm_cmpgt_ps(tz, best);
+			best = select(mask, tz, best); qx = select(mask, e, qx); qy = select(mask, f, qy); qz = select(mask, tz, qz); qw = select(mask, c, qw);
+			
+			__m128 k = _mm_div_ps(half, _mm_sqrt_ps(best));
+			
+			qx = _mm_mul_ps(qx, k);
+			qy = _mm_mul_ps(qy, k);
+			qz = _mm_mul_ps(qz, k);
+			qw = _mm_mul_ps(qw, k);
+			
+			_MM_TRANSPOSE4_PS(qx, qy, qz, qw);
+			
+			_mm_storeu_ps(result[0].data(), qx);
+			_mm_storeu_ps(result[1].data(), qy);
+			_mm_storeu_ps(result[2].data(), qz);
+			_mm_storeu_ps(result[3].data(), qw);
+		}
+		
+		// Load four quaternions, transposed so that each register holds one component:
+		inline void load_transposed(const Quaternion<float> * source, __m128 & x, __m128 & y, __m128 & z, __m128 & w)
+		{
+			x = _mm_loadu_ps(source[0].data());
+			y = _mm_loadu_ps(source[1].data());
+			z = _mm_loadu_ps(source[2].data());
+			w = _mm_loadu_ps(source[3].data());
+			
+			_MM_TRANSPOSE4_PS(x, y, z, w);
+		}
+		
+		// Compute the first three columns of four rotation matrices, one register per element, such that m[c][r] is element (r, c):
+		inline void rotation_4(const Quaternion<float> * source, __m128 (&m)[3][4])
+		{
+			__m128 x, y, z, w;
+			load_transposed(source, x, y, z, w);
+			
+			__m128 x2 = _mm_add_ps(x, x), y2 = _mm_add_ps(y, y), z2 = _mm_add_ps(z, z);
+			__m128 xx = _mm_mul_ps(x, x2), xy = _mm_mul_ps(x, y2), xz = _mm_mul_ps(x, z2);
+			__m128 yy = _mm_mul_ps(y, y2), yz = _mm_mul_ps(y, z2), zz = _mm_mul_ps(z, z2);
+			__m128 wx = _mm_mul_ps(w, x2), wy = _mm_mul_ps(w, y2), wz = _mm_mul_ps(w, z2);
+			
+			const __m128 one = _mm_set1_ps(1), zero = _mm_setzero_ps();
+			
+			m[0][0] = _mm_sub_ps(one, _mm_add_ps(yy, zz));
+			m[0][1] = _mm_add_ps(xy, wz);
+			m[0][2] = _mm_sub_ps(xz, wy);
+			m[0][3] = zero;
+			
+			m[1][0] = _mm_sub_ps(xy, wz);
+			m[1][1] = _mm_sub_ps(one, _mm_add_ps(xx, zz));
+			m[1][2] = _mm_add_ps(yz, wx);
+			m[1][3] = zero;
+			
+			m[2][0] = _mm_add_ps(xz, wy);
+			m[2][1] = _mm_sub_ps(yz, wx);
+			m[2][2] = _mm_sub_ps(one, _mm_add_ps(xx, yy));
+			m[2][3] = zero;
+			
+			// Transposing turns the elements back into columns, m[c][i] being column c of matrix i:
+			for (std::size_t c = 0; c < 3; c += 1)
+				_MM_TRANSPOSE4_PS(m[c][0], m[c][1], m[c][2], m[c][3]);
+		}
+		
+		// The same polynomial as Interpolate::spherical_linear_weight, for four lanes:
+		inline __m128 spherical_linear_weight_4(__m128 t, __m128 x)
+		{
+			const float MU = 1.85298109240830f;
+			const float u[8] = {1.0f/3, 1.0f/10, 1.0f/21, 1.0f/36, 1.0f/55, 1.0f/78, 1.0f/105, MU/136};
+			const float v[8] = {1.0f/3, 2.0f/5, 3.0f/7, 4.0f/9, 5.0f/11, 6.0f/13, 7.0f/15, MU*8/17};
+			
+			const __m128 one = _mm_set1_ps(1);
+			__m128 t2 = _mm_mul_ps(t, t), r = one;
+			
+			for (std::size_t i = 8; i-- > 0;) {
+				__m128 b = _mm_mul_ps(_mm_sub_ps(_mm_mul_ps(_mm_set1_ps(u[i]), t2), _mm_set1_ps(v[i])), x);
+				r = _mm_add_ps(one, _mm_mul_ps(b, r));
+			}
+			
+			return _mm_mul_ps(t, r);
+		}
+		
+		template <std::size_t R>
+		void convert_all(Quaternion<float> * result, const Matrix<R, R, float> * source, std::size_t count)
+		{
+			std::size_t i = 0;
+			
+			for (; i + 4 <= count; i += 4)
+				convert_4(result + i, source + i);
+			
+			for (; i < count; i += 1)
+				result[i] = Quaternion<float>(source[i]);
+		}
+	}
+	
+	void multiply(Quaternion<float> & result, const Quaternion<float> & left, const Quaternion<float> & right)
+	{
+		__m128 q1 = _mm_loadu_ps(left.data()), q2 = _mm_loadu_ps(right.data());
+		
+		// Each component of the left hand side multiplies a permutation of the right hand side with some signs flipped:
+		const __m128 x_signs = _mm_setr_ps(0.0f, -0.0f, 0.0f, -0.0f);
+		const __m128 y_signs = _mm_setr_ps(0.0f, 0.0f, -0.0f, -0.0f);
+		const __m128 z_signs = _mm_setr_ps(-0.0f, 0.0f, 0.0f, -0.0f);
+		
+		// r = w1 * (x2, y2, z2, w2) + x1 * (w2, -z2, y2, -x2) + y1 * (z2, w2, -x2, -y2) + z1 * (-y2, x2, w2, -z2)
+		__m128 r = _mm_mul_ps(_mm_shuffle_ps(q1, q1, _MM_SHUFFLE(3, 3, 3, 3)), q2);
+		r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(q1, q1, _MM_SHUFFLE(0, 0, 0, 0)), _mm_xor_ps(_mm_shuffle_ps(q2, q2, _MM_SHUFFLE(0, 1, 2, 3)), x_signs)));
+		r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(q1, q1, _MM_SHUFFLE(1, 1, 1, 1)), _mm_xor_ps(_mm_shuffle_ps(q2, q2, _MM_SHUFFLE(1, 0, 3, 2)), y_signs)));
+		r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(q1, q1, _MM_SHUFFLE(2, 2, 2, 2)), _mm_xor_ps(_mm_shuffle_ps(q2, q2, _MM_SHUFFLE(2, 3, 0, 1)), z_signs)));
+		
+		_mm_storeu_ps(result.data(), r);
+	}
+	
+	void multiply(Quaternion<double> & result, const Quaternion<double> & left, const Quaternion<double> & right)
+	{
+		// The same scheme as above, with each quaternion split into (x, y) and (z, w):
+		__m128d xy = _mm_loadu_pd(right.data()), zw = _mm_loadu_pd(right.data() + 2);
+		__m128d yx = _mm_shuffle_pd(xy, xy, 1), wz = _mm_shuffle_pd(zw, zw, 1);
+		
+		const __m128d odd = _mm_setr_pd(0.0, -0.0), even = _mm_setr_pd(-0.0, 0.0), both = _mm_set1_pd(-0.0);
+		
+		__m128d x1 = _mm_set1_pd(left[X]), y1 = _mm_set1_pd(left[Y]), z1 = _mm_set1_pd(left[Z]), w1 = _mm_set1_pd(left[W]);
+		
+		__m128d lo = _mm_mul_pd(w1, xy), hi = _mm_mul_pd(w1, zw);
+		
+		lo = _mm_add_pd(lo, _mm_mul_pd(x1, _mm_xor_pd(wz, odd)));
+		hi = _mm_add_pd(hi, _mm_mul_pd(x1, _mm_xor_pd(yx, odd)));
+		
+		lo = _mm_add_pd(lo, _mm_mul_pd(y1, zw));
+		hi = _mm_add_pd(hi, _mm_mul_pd(y1, _mm_xor_pd(xy, both)));
+		
+		lo = _mm_add_pd(lo, _mm_mul_pd(z1, _mm_xor_pd(yx, even)));
+		hi = _mm_add_pd(hi, _mm_mul_pd(z1, _mm_xor_pd(wz, odd)));
+		
+		_mm_storeu_pd(result.data(), lo);
+		_mm_storeu_pd(result.data() + 2, hi);
+	}
+	
+	void multiply(Vector<3, float> * result, const Quaternion<float> * left, const Vector<3, float> * right, std::size_t count)
+	{
+		static_assert(sizeof(Vector<3, float>) == sizeof(float) * 3, "Vector<3, float> must be packed!");
+		
+		std::size_t i = 0;
+		
+		for (; i + 4 <= count; i += 4) {
+			__m128 qx, qy, qz, qw, vx, vy, vz;
+			
+			load_transposed(left + i, qx, qy, qz, qw);
+			
+			const float * p = right[i].data();
+			deinterleave(_mm_loadu_ps(p), _mm_loadu_ps(p + 4), _mm_loadu_ps(p + 8), vx, vy, vz);
+			
+			// t = 2 * cross(q, v):
+			__m128 tx = _mm_sub_ps(_mm_mul_ps(qy, vz), _mm_mul_ps(qz, vy));
+			__m128 ty = _mm_sub_ps(_mm_mul_ps(qz, vx), _mm_mul_ps(qx, vz));
+			__m128 tz = _mm_sub_ps(_mm_mul_ps(qx, vy), _mm_mul_ps(qy, vx));
+			
+			tx = _mm_add_ps(tx, tx);
+			ty = _mm_add_ps(ty, ty);
+			tz = _mm_add_ps(tz, tz);
+			
+			// v + w * t + cross(q, t):
+			vx = _mm_add_ps(_mm_add_ps(vx, _mm_mul_ps(qw, tx)), _mm_sub_ps(_mm_mul_ps(qy, tz), _mm_mul_ps(qz, ty)));
+			vy = _mm_add_ps(_mm_add_ps(vy, _mm_mul_ps(qw, ty)), _mm_sub_ps(_mm_mul_ps(qz, tx), _mm_mul_ps(qx, tz)));
+			vz = _mm_add_ps(_mm_add_ps(vz, _mm_mul_ps(qw, tz)), _mm_sub_ps(_mm_mul_ps(qx, ty), _mm_mul_ps(qy, tx)));
+			
+			__m128 a, b, c;
+			interleave(vx, vy, vz, a, b, c);
+			
+			float * r = result[i].data();
+			_mm_storeu_ps(r, a);
+			_mm_storeu_ps(r + 4, b);
+			_mm_storeu_ps(r + 8, c);
+		}
+		
+		for (; i < count; i += 1)
+			result[i] = left[i] * right[i];
+	}
+	
+	void conjugate(Quaternion<float> * result, const Quaternion<float> * source, std::size_t count)
+	{
+		const __m128 signs = _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f);
+		
+		for (std::size_t i = 0; i < count; i += 1)
+			_mm_storeu_ps(result[i].data(), _mm_xor_ps(_mm_loadu_ps(source[i].data()), signs));
+	}
+	
+	void conjugate(Quaternion<double> * result, const Quaternion<double> * source, std::size_t count)
+	{
+		const __m128d signs = _mm_setr_pd(-0.0, 0.0);
+		
+		for (std::size_t i = 0; i < count; i += 1) {
+			_mm_storeu_pd(result[i].data(), _mm_xor_pd(_mm_loadu_pd(source[i].data()), _mm_set1_pd(-0.0)));
+			_mm_storeu_pd(result[i].data() + 2, _mm_xor_pd(_mm_loadu_pd(source[i].data() + 2), signs));
+		}
+	}
+	
+	namespace Interpolate
+	{
+		void fast_spherical_linear(std::size_t count, const float * t, QuaternionArrays<const float> q0, QuaternionArrays<const float> q1, QuaternionArrays<float> result)
+		{
+			const __m128 one = _mm_set1_ps(1), sign_mask = _mm_set1_ps(-0.0f);
+			std::size_t i = 0;
+			
+			for (; i + 4 <= count; i += 4) {
+				__m128 x0 = _mm_loadu_ps(q0.x + i), y0 = _mm_loadu_ps(q0.y + i), z0 = _mm_loadu_ps(q0.z + i), w0 = _mm_loadu_ps(q0.w + i);
+				__m128 x1 = _mm_loadu_ps(q1.x + i), y1 = _mm_loadu_ps(q1.y + i), z1 = _mm_loadu_ps(q1.z + i), w1 = _mm_loadu_ps(q1.w + i);
+				__m128 ti = _mm_loadu_ps(t + i);
+				
+				__m128 dot = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x0, x1), _mm_mul_ps(y0, y1)), _mm_add_ps(_mm_mul_ps(z0, z1), _mm_mul_ps(w0, w1)));
+				
+				// Take the shorter path by flipping the sign of q1's weight where the dot product is negative:
+				__m128 sign = _mm_and_ps(dot, sign_mask);
+				__m128 x = _mm_sub_ps(_mm_xor_ps(dot, sign), one);
+				
+				__m128 a = spherical_linear_weight_4(_mm_sub_ps(one, ti), x);
+				__m128 b = _mm_xor_ps(spherical_linear_weight_4(ti, x), sign);
+				
+				_mm_storeu_ps(result.x + i, _mm_add_ps(_mm_mul_ps(x0, a), _mm_mul_ps(x1, b)));
+				_mm_storeu_ps(result.y + i, _mm_add_ps(_mm_mul_ps(y0, a), _mm_mul_ps(y1, b)));
+				_mm_storeu_ps(result.z + i, _mm_add_ps(_mm_mul_ps(z0, a), _mm_mul_ps(z1, b)));
+				_mm_storeu_ps(result.w + i, _mm_add_ps(_mm_mul_ps(w0, a), _mm_mul_ps(w1, b)));
+			}
+			
+			for (; i < count; i += 1) {
+				Quaternion<float> r = fast_spherical_linear(t[i], Quaternion<float>({q0.x[i], q0.y[i], q0.z[i], q0.w[i]}), Quaternion<float>({q1.x[i], q1.y[i], q1.z[i], q1.w[i]}));
+				
+				result.x[i] = r[X]; result.y[i] = r[Y]; result.z[i] = r[Z]; result.w[i] = r[W];
+			}
+		}
+	}
+	
+	template <>
+	void SmallestThree<10, std::uint32_t>::encode(std::uint32_t * result, const Quaternion<float> * source, std::size_t count)
+	{
+		const __m128 sign_mask = _mm_set1_ps(-0.0f), one = _mm_set1_ps(1), zero = _mm_setzero_ps();
+		const __m128 sqrt2 = _mm_set1_ps(float(M_SQRT2)), half = _mm_set1_ps(MAXIMUM * 0.5f), maximum = _mm_set1_ps(float(MAXIMUM));
+		
+		auto quantize = [&](__m128 value) {
+			return _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(value, sqrt2), one), half), zero), maximum));
+		};
+		
+		std::size_t i = 0;
+		
+		for (; i + 4 <= count; i += 4) {
+			__m128 x, y, z, w;
+			load_transposed(source + i, x, y, z, w);
+			
+			// Find the index of the largest component, using the same order of comparisons as the scalar version:
+			__m128 index = zero, largest = x, magnitude = _mm_andnot_ps(sign_mask, x), mask;
+			
+			mask = _mm_cmpgt_ps(_mm_andnot_ps(sign_mask, y), magnitude);
+			index = select(mask, _mm_set1_ps(1), index); largest = select(mask, y, largest); magnitude = _mm_andnot_ps(sign_mask, largest);
+			
+			mask = _mm_cmpgt_ps(_mm_andnot_ps(sign_mask, z), magnitude);
+			index = select(mask, _mm_set1_ps(2), index); largest = select(mask, z, largest); magnitude = _mm_andnot_ps(sign_mask, largest);
+			
+			mask = _mm_cmpgt_ps(_mm_andnot_ps(sign_mask, w), magnitude);
+			index = select(mask, _mm_set1_ps(3), index); largest = select(mask, w, largest);
+			
+			// The remaining components in order, negated if the largest is negative:
+			__m128 sign = _mm_and_ps(largest, sign_mask);
+			__m128 a = _mm_xor_ps(select(_mm_cmpeq_ps(index, zero), y, x), sign);
+			__m128 b = _mm_xor_ps(select(_mm_cmple_ps(index, one), z, y), sign);
+			__m128 c = _mm_xor_ps(select(_mm_cmple_ps(index, _mm_set1_ps(2)), w, z), sign);
+			
+			__m128i value = _mm_slli_epi32(_mm_cvtps_epi32(index), 30);
+			value = _mm_or_si128(value, _mm_slli_epi32(quantize(a), 20));
+			value = _mm_or_si128(value, _mm_slli_epi32(quantize(b), 10));
+			value = _mm_or_si128(value, quantize(c));
+			
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(result + i), value);
+		}
+		
+		for (; i < count; i += 1)
+			result[i] = encode(source[i]);
+	}
+	
+	template <>
+	void SmallestThree<10, std::uint32_t>::decode(Quaternion<float> * result, const std::uint32_t * source, std::size_t count)
+	{
+		const __m128i mask = _mm_set1_epi32(MAXIMUM);
+		const __m128 scale = _mm_set1_ps(float(M_SQRT2 / MAXIMUM)), offset = _mm_set1_ps(float(M_SQRT1_2)), one = _mm_set1_ps(1), zero = _mm_setzero_ps();
+		
+		auto component = [&](__m128i value) {
+			return _mm_sub_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(value, mask)), scale), offset);
+		};
+		
+		std::size_t i = 0;
+		
+		for (; i + 4 <= count; i += 4) {
+			__m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + i));
+			__m128i index = _mm_srli_epi32(value, 30);
+			
+			__m128 a = component(_mm_srli_epi32(value, 20)), b = component(_mm_srli_epi32(value, 10)), c = component(value);
+			__m128 sum = _mm_add_ps(_mm_add_ps(_mm_mul_ps(a, a), _mm_mul_ps(b, b)), _mm_mul_ps(c, c));
+			__m128 largest = _mm_sqrt_ps(_mm_max_ps(_mm_sub_ps(one, sum), zero));
+			
+			__m128 e0 = _mm_castsi128_ps(_mm_cmpeq_epi32(index, _mm_set1_epi32(0)));
+			__m128 e1 = _mm_castsi128_ps(_mm_cmpeq_epi32(index, _mm_set1_epi32(1)));
+			__m128 e2 = _mm_castsi128_ps(_mm_cmpeq_epi32(index, _mm_set1_epi32(2)));
+			__m128 e3 = _mm_castsi128_ps(_mm_cmpeq_epi32(index, _mm_set1_epi32(3)));
+			
+			// Insert the largest component at its index, shifting the others along:
+			__m128 x = select(e0, largest, a);
+			__m128 y = select(e0, a, select(e1, largest, b));
+			__m128 z = select(_mm_or_ps(e0, e1), b, select(e2, largest, c));
+			__m128 w = select(e3, largest, c);
+			
+			_MM_TRANSPOSE4_PS(x, y, z, w);
+			
+			_mm_storeu_ps(result[i].data(), x);
+			_mm_storeu_ps(result[i + 1].data(), y);
+			_mm_storeu_ps(result[i + 2].data(), z);
+			_mm_storeu_ps(result[i + 3].data(), w);
+		}
+		
+		for (; i < count; i += 1)
+			result[i] = decode(source[i]);
+	}
+	
+	void convert(Matrix<4, 4, float> * result, const Quaternion<float> * source, std::size_t count)
+	{
+		const __m128 column = _mm_setr_ps(0, 0, 0, 1);
+		std::size_t i = 0;
+		
+		for (; i + 4 <= count; i += 4) {
+			__m128 m[3][4];
+			rotation_4(source + i, m);
+			
+			for (std::size_t j = 0; j < 4; j += 1) {
+				float * r = result[i + j].data();
+				
+				_mm_store_ps(r, m[0][j]);
+				_mm_store_ps(r + 4, m[1][j]);
+				_mm_store_ps(r + 8, m[2][j]);
+				_mm_store_ps(r + 12, column);
+			}
+		}
+		
+		for (; i < count; i += 1)
+			result[i] = Matrix<4, 4, float>(source[i]);
+	}
+	
+	void convert(Matrix<3, 4, float> * result, const Quaternion<float> * source, std::size_t count)
+	{
+		static_assert(sizeof(Matrix<3, 4, float>) == sizeof(float) * 12, "Matrix<3, 4, float> must be packed!");
+		
+		const __m128 zero = _mm_setzero_ps();
+		std::size_t i = 0;
+		
+		for (; i + 4 <= count; i += 4) {
+			__m128 m[3][4];
+			rotation_4(source + i, m);
+			
+			for (std::size_t j = 0; j < 4; j += 1) {
+				float * r = result[i + j].data();
+				
+				// Columns are three elements apart, so each store overwrites the last element of the previous one, and the final store writes (m22, 0, 0, 0):
+				_mm_store_ps(r, m[0][j]);
+				_mm_storeu_ps(r + 3, m[1][j]);
+				_mm_storeu_ps(r + 6, m[2][j]);
+				_mm_store_ps(r + 8, _mm_shuffle_ps(m[2][j], zero, _MM_SHUFFLE(0, 0, 3, 2)));
+			}
+		}
+		
+		for (; i < count; i += 1)
+			result[i] = Matrix<3, 4, float>(source[i]);
+	}
+	
+	void convert(Quaternion<float> * result, const Matrix<4, 4, float> * source, std::size_t count)
+	{
+		convert_all(result, source, count);
+	}
+	
+	void convert(Quaternion<float> * result, const Matrix<3, 3, float> * source, std::size_t count)
+	{
+		convert_all(result, source, count);
+	}
+}
+
+#endif
@@ -0,0 +1,47 @@
+//
+//  SSE.hpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#ifdef __SSE2__
+
+#define NUMERICS_QUATERNION_SSE
+
+#include "../Quaternion.hpp"
+#include "../Matrix.hpp"
+
+#include <cstddef>
+
+namespace Numerics
+{
+	// The Hamilton product, using shuffles of the right hand side and sign flips rather than sixteen scalar multiplies:
+	void multiply(Quaternion<float> & result, const Quaternion<float> & left, const Quaternion<float> & right);
+	void multiply(Quaternion<double> & result, const Quaternion<double> & left, const Quaternion<double> & right);
+	
+	// Rotate an array of points, four at a time:
+	void multiply(Vector<3, float> * result, const Quaternion<float> * left, const Vector<3, float> * right, std::size_t count);
+	
+	void conjugate(Quaternion<float> * result, const Quaternion<float> * source, std::size_t count);
+	void conjugate(Quaternion<double> * result, const Quaternion<double> * source, std::size_t count);
+	
+	// Convert arrays of unit quaternions to rotation matrices, four at a time. The Matrix<3, 4> variant is an affine transform with zero translation:
+	void convert(Matrix<4, 4, float> * result, const Quaternion<float> * source, std::size_t count);
+	void convert(Matrix<3, 4, float> * result, const Quaternion<float> * source, std::size_t count);
+	
+	namespace Interpolate
+	{
+		// Approximate spherical linear interpolation of four quaternions at a time:
+		void fast_spherical_linear(std::size_t count, const float * t, QuaternionArrays<const float> q0, QuaternionArrays<const float> q1, QuaternionArrays<float> result);
+	}
+	
+	// These are optimised specializations for SSE2, which convert four matrices at a time using branchless selection:
+	void convert(Quaternion<float> * result, const Matrix<4, 4, float> * source, std::size_t count);
+	void convert(Quaternion<float> * result, const Matrix<3, 3, float> * source, std::size_t count);
+}
+
+#endif
@@ -11,6 +11,7 @@
 #include <cmath>
 
 #include "Float.hpp"
+#include "Trigonometry.hpp"
 
 namespace Numerics
 {
@@ -92,20 +93,33 @@ namespace Numerics
 		}
 
 		Number<FloatT> sin() const {
-			return std::sin(value);
+			using std::sin;
+			return sin(value);
 		}
 
 		Number<FloatT> cos() const {
-			return std::cos(value);
+			using std::cos;
+			return cos(value);
 		}
 
 		Number<FloatT> tan() const {
-			return std::tan(value);
+			using std::tan;
+			return tan(value);
+		}
+
+		/// Compute the sine and cosine together, which is faster than computing them separately.
+		template <Precision PRECISION = EXACT>
+		void sin_cos(FloatT & sine, FloatT & cosine) const {
+			Trigonometry::sin_cos<PRECISION>(value, sine, cosine);
+		}
+
+		/// The equivalent angle in (-pi, pi].
+		Radians wrap() const {
+			return Radians{Trigonometry::wrap(value)};
 		}
 
 		Radians offset_to (const Radians & other) const {
-			auto x = this->value, y = other.value;
-			return Radians{std::atan2(std::sin(x-y), std::cos(x-y))};
+			return Radians{Trigonometry::wrap(this->value - other.value)};
 		}
 
 		bool equivalent(const Radians & other) const {
@@ -0,0 +1,15 @@
+//
+//  Sort.cpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Sort.hpp"
+
+namespace Numerics
+{
+	template void radix_sort(float * keys, std::size_t count);
+	template void radix_sort(double * keys, std::size_t count);
+}
@@ -0,0 +1,223 @@
+//
+//  Sort.hpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "Float.hpp"
+
+#include <array>
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
+#include "Sort/SSE.hpp"
+
+namespace Numerics
+{
+	namespace Radix
+	{
+		/// Maps keys to unsigned integers with the same order. Floating point keys use FloatEquivalenceTraits::convert_to_integer, so -0 and +0 are equal, and NaN sorts before or after every other value depending on its sign.
+		template <typename KeyT>
+		struct KeyTraits
+		{
+			typedef FloatEquivalenceTraits<KeyT> F;
+			typedef typename F::UnsignedT UnsignedT;
+
+			static constexpr UnsignedT SIGN = UnsignedT(1) << (sizeof(UnsignedT) * 8 - 1);
+
+			static UnsignedT convert(const KeyT & key)
+			{
+				return UnsignedT(F::convert_to_integer(key)) ^ SIGN;
+			}
+		};
+
+		template <>
+		struct KeyTraits<std::uint32_t>
+		{
+			typedef std::uint32_t UnsignedT;
+
+			static UnsignedT convert(const std::uint32_t & key) {return key;}
+		};
+
+		template <>
+		struct KeyTraits<std::uint64_t>
+		{
+			typedef std::uint64_t UnsignedT;
+
+			static UnsignedT convert(const std::uint64_t & key) {return key;}
+		};
+
+		/// Each pass sorts by an 11 bit digit, so 32 bit keys take 3 passes and 64 bit keys take 6, and the histogram of each pass fits in the L1 cache.
+		constexpr std::size_t BITS = 11;
+		constexpr std::size_t BUCKETS = 1 << BITS;
+
+		template <typename KeyT>
+		struct Passes
+		{
+			static constexpr std::size_t COUNT = (sizeof(typename KeyTraits<KeyT>::UnsignedT) * 8 + BITS - 1) / BITS;
+		};
+
+		typedef std::array<std::size_t, BUCKETS> HistogramT;
+
+		template <typename KeyT>
+		using HistogramsT = std::array<HistogramT, Passes<KeyT>::COUNT>;
+
+		template <typename KeyT>
+		inline std::size_t digit(const KeyT & key, std::size_t pass)
+		{
+			return (KeyTraits<KeyT>::convert(key) >> (pass * BITS)) & (BUCKETS - 1);
+		}
+
+		/// Count the digits of every pass in a single read of the keys. The histograms are accumulated, so they must be zeroed first.
+		template <typename KeyT>
+		void histogram(const KeyT * keys, std::size_t count, HistogramsT<KeyT> & histograms)
+		{
+			for (std::size_t i = 0; i < count; i += 1) {
+				auto key = KeyTraits<KeyT>::convert(keys[i]);
+
+				for (std::size_t pass = 0; pass < Passes<KeyT>::COUNT; pass += 1)
+					histograms[pass][(key >> (pass * BITS)) & (BUCKETS - 1)] += 1;
+			}
+		}
+
+#ifdef NUMERICS_SORT_SSE
+		inline void histogram(const float * keys, std::size_t count, HistogramsT<float> & histograms)
+		{
+			static_assert(sizeof(histograms) == sizeof(std::size_t) * BUCKETS * Passes<float>::COUNT, "Histograms must be contiguous!");
+
+			radix_histogram(keys, count, histograms[0].data());
+		}
+#endif
+
+		/// Count the digits of a single pass.
+		template <typename KeyT>
+		void histogram(const KeyT * keys, std::size_t count, std::size_t pass, HistogramT & histogram)
+		{
+			for (std::size_t i = 0; i < count; i += 1)
+				histogram[digit(keys[i], pass)] += 1;
+		}
+
+		/// Whether every key has the same digit, in which case the pass doesn't change the order and can be skipped.
+		inline bool trivial(const HistogramT & histogram, std::size_t count)
+		{
+			return std::find(histogram.begin(), histogram.end(), count) != histogram.end();
+		}
+
+		/// Convert counts to the offset of the first element of each bucket, starting at the given offset.
+		inline void offsets(HistogramT & histogram, std::size_t offset = 0)
+		{
+			for (auto & bucket : histogram) {
+				std::size_t size = bucket;
+				bucket = offset;
+				offset += size;
+			}
+		}
+
+		/// Move each key, and its value if there are values, to the next offset of its bucket. This is stable, which is required for sorting by the later digits.
+		template <typename KeyT, typename ValueT>
+		void scatter(const KeyT * keys, const ValueT * values, std::size_t count, std::size_t pass, HistogramT & offsets, KeyT * sorted_keys, ValueT * sorted_values)
+		{
+			if (values) {
+				for (std::size_t i = 0; i < count; i += 1) {
+					std::size_t index = offsets[digit(keys[i], pass)]++;
+
+					sorted_keys[index] = keys[i];
+					sorted_values[index] = values[i];
+				}
+			} else {
+				for (std::size_t i = 0; i < count; i += 1)
+					sorted_keys[offsets[digit(keys[i], pass)]++] = keys[i];
+			}
+		}
+
+		/// Sort the keys, and the values if not null, using the given buffers of the same size. The result is in either the input or the buffers, and the returned flag is true if it's in the buffers.
+		template <typename KeyT, typename ValueT>
+		bool sort(KeyT * keys, ValueT * values, std::size_t count, KeyT * key_buffer, ValueT * value_buffer)
+		{
+			HistogramsT<KeyT> histograms = {};
+			histogram(keys, count, histograms);
+
+			bool swapped = false;
+
+			for (std::size_t pass = 0; pass < Passes<KeyT>::COUNT; pass += 1) {
+				if (trivial(histograms[pass], count)) continue;
+
+				offsets(histograms[pass]);
+				scatter(keys, values, count, pass, histograms[pass], key_buffer, value_buffer);
+
+				std::swap(keys, key_buffer);
+				std::swap(values, value_buffer);
+				swapped = !swapped;
+			}
+
+			return swapped;
+		}
+
+		/// Large values are sorted indirectly, by sorting an index with the keys and then moving each value once.
+		template <typename ValueT>
+		struct Indirect
+		{
+			static constexpr bool VALUE = sizeof(ValueT) > 2 * sizeof(std::uint32_t);
+		};
+
+		/// Sort keys and values using the given function, which has the same signature as sort above, and move the results back into the input.
+		template <typename KeyT, typename ValueT, typename SortT>
+		void sort(KeyT * keys, ValueT * values, std::size_t count, SortT sort)
+		{
+			std::vector<KeyT> key_buffer(count);
+
+			if (Indirect<ValueT>::VALUE && count <= std::numeric_limits<std::uint32_t>::max()) {
+				std::vector<std::uint32_t> indices(count), index_buffer(count);
+
+				for (std::size_t i = 0; i < count; i += 1) indices[i] = i;
+
+				if (sort(keys, indices.data(), count, key_buffer.data(), index_buffer.data())) {
+					std::copy(key_buffer.begin(), key_buffer.end(), keys);
+					indices.swap(index_buffer);
+				}
+
+				std::vector<ValueT> sorted(count);
+
+				for (std::size_t i = 0; i < count; i += 1)
+					sorted[i] = std::move(values[indices[i]]);
+
+				std::move(sorted.begin(), sorted.end(), values);
+			} else {
+				std::vector<ValueT> value_buffer(count);
+
+				if (sort(keys, values, count, key_buffer.data(), value_buffer.data())) {
+					std::copy(key_buffer.begin(), key_buffer.end(), keys);
+					std::move(value_buffer.begin(), value_buffer.end(), values);
+				}
+			}
+		}
+	}
+
+	/// Sort keys in ascending order using a least significant digit radix sort, which takes a few passes over the keys regardless of their values. Keys may be float, double, std::uint32_t or std::uint64_t. Temporary storage the size of the keys is allocated.
+	template <typename KeyT>
+	void radix_sort(KeyT * keys, std::size_t count)
+	{
+		std::vector<KeyT> buffer(count);
+
+		if (Radix::sort(keys, static_cast<KeyT *>(nullptr), count, buffer.data(), static_cast<KeyT *>(nullptr)))
+			std::copy(buffer.begin(), buffer.end(), keys);
+	}
+
+	/// Sort keys in ascending order, and reorder the values in the same way, e.g. to sort vectors or matrices by depth. The sort is stable. Values larger than 8 bytes are moved once, after sorting an index.
+	template <typename KeyT, typename ValueT>
+	void radix_sort(KeyT * keys, ValueT * values, std::size_t count)
+	{
+		Radix::sort(keys, values, count, [](KeyT * pass_keys, auto * pass_values, std::size_t size, KeyT * key_buffer, auto * value_buffer) {
+			return Radix::sort(pass_keys, pass_values, size, key_buffer, value_buffer);
+		});
+	}
+
+	extern template void radix_sort(float * keys, std::size_t count);
+	extern template void radix_sort(double * keys, std::size_t count);
+}
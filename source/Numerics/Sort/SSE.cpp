@@ -0,0 +1,63 @@
+//
+//  SSE.cpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "SSE.hpp"
+
+#ifdef NUMERICS_SORT_SSE
+
+#include <emmintrin.h>
+#include <cstdint>
+#include <cstring>
+
+namespace Numerics
+{
+	namespace Radix
+	{
+		void radix_histogram(const float * keys, std::size_t count, std::size_t * histograms)
+		{
+			std::size_t * low = histograms, * middle = histograms + 2048, * high = histograms + 4096;
+
+			const __m128i SIGN = _mm_set1_epi32(0x80000000), MASK = _mm_set1_epi32(0x7FF);
+
+			std::size_t i = 0;
+
+			for (; i + 4 <= count; i += 4) {
+				__m128i bits = _mm_loadu_si128(reinterpret_cast<const __m128i *>(keys + i));
+
+				// The same mapping as FloatEquivalenceTraits::convert_to_integer, with the sign bit flipped so that the order is unsigned:
+				__m128i negative = _mm_srai_epi32(bits, 31);
+				__m128i ordered = _mm_or_si128(_mm_and_si128(negative, _mm_sub_epi32(SIGN, bits)), _mm_andnot_si128(negative, bits));
+				ordered = _mm_xor_si128(ordered, SIGN);
+
+				std::uint32_t digits[3][4];
+				_mm_storeu_si128(reinterpret_cast<__m128i *>(digits[0]), _mm_and_si128(ordered, MASK));
+				_mm_storeu_si128(reinterpret_cast<__m128i *>(digits[1]), _mm_and_si128(_mm_srli_epi32(ordered, 11), MASK));
+				_mm_storeu_si128(reinterpret_cast<__m128i *>(digits[2]), _mm_srli_epi32(ordered, 22));
+
+				for (std::size_t k = 0; k < 4; k += 1) {
+					low[digits[0][k]] += 1;
+					middle[digits[1][k]] += 1;
+					high[digits[2][k]] += 1;
+				}
+			}
+
+			for (; i < count; i += 1) {
+				std::int32_t integer;
+				std::memcpy(&integer, keys + i, sizeof(integer));
+
+				std::uint32_t ordered = std::uint32_t(integer < 0 ? std::int32_t(0x80000000) - integer : integer) ^ 0x80000000;
+
+				low[ordered & 0x7FF] += 1;
+				middle[(ordered >> 11) & 0x7FF] += 1;
+				high[ordered >> 22] += 1;
+			}
+		}
+	}
+}
+
+#endif
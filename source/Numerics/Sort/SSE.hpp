@@ -0,0 +1,26 @@
+//
+//  SSE.hpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#ifdef __SSE2__
+
+#define NUMERICS_SORT_SSE
+
+#include <cstddef>
+
+namespace Numerics
+{
+	namespace Radix
+	{
+		// Count the three 11 bit digits of the ordered integers of float keys, which are computed four at a time. The histograms are consecutive arrays of 2048 buckets, and are accumulated:
+		void radix_histogram(const float * keys, std::size_t count, std::size_t * histograms);
+	}
+}
+
+#endif
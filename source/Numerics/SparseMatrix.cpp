@@ -0,0 +1,15 @@
+//
+//  SparseMatrix.cpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "SparseMatrix.hpp"
+
+namespace Numerics
+{
+	template class SparseMatrix<float>;
+	template class SparseMatrix<double>;
+}
@@ -0,0 +1,244 @@
+//
+//  SparseMatrix.hpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "DynamicMatrix.hpp"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace Numerics
+{
+	/// A single (row, column, value) entry used to assemble sparse matrices.
+	template <typename ValueT>
+	struct Triplet
+	{
+		std::size_t row, column;
+		ValueT value;
+	};
+
+	namespace Sparse
+	{
+		/// Column indices are stored as 32-bit integers to reduce memory traffic.
+		typedef std::uint32_t IndexT;
+
+		template <typename ValueT>
+		using StorageT = std::vector<ValueT, AlignedAllocator<ValueT>>;
+
+		template <typename NumericT>
+		void accumulate(NumericT & value, const NumericT & other)
+		{
+			value += other;
+		}
+
+		template <std::size_t R, std::size_t C, typename NumericT>
+		void accumulate(Matrix<R, C, NumericT> & value, const Matrix<R, C, NumericT> & other)
+		{
+			for (std::size_t i = 0; i < R*C; i += 1)
+				value[i] += other[i];
+		}
+
+		/// Compress triplets into row offsets, column indices and values. Entries with the same row and column are summed in the order they were given.
+		template <typename ValueT>
+		void assemble(std::size_t rows, std::size_t columns, const Triplet<ValueT> * triplets, std::size_t count, std::vector<std::size_t> & offsets, std::vector<IndexT> & indices, StorageT<ValueT> & values)
+		{
+			assert(columns <= std::numeric_limits<IndexT>::max());
+
+			// Bucket the triplets by row:
+			std::vector<std::size_t> starts(rows + 1, 0);
+
+			for (std::size_t i = 0; i < count; i += 1) {
+				assert(triplets[i].row < rows && triplets[i].column < columns);
+
+				starts[triplets[i].row + 1] += 1;
+			}
+
+			for (std::size_t r = 0; r < rows; r += 1)
+				starts[r + 1] += starts[r];
+
+			std::vector<std::size_t> order(count), next(starts.begin(), starts.end() - 1);
+
+			for (std::size_t i = 0; i < count; i += 1)
+				order[next[triplets[i].row]++] = i;
+
+			offsets.assign(rows + 1, 0);
+			indices.clear();
+			values.clear();
+
+			// Sort each row by column and merge duplicates:
+			for (std::size_t r = 0; r < rows; r += 1) {
+				auto begin = order.begin() + starts[r], end = order.begin() + starts[r + 1];
+
+				std::stable_sort(begin, end, [&](std::size_t a, std::size_t b) {
+					return triplets[a].column < triplets[b].column;
+				});
+
+				std::size_t row_start = indices.size();
+
+				for (auto i = begin; i != end; ++i) {
+					const auto & triplet = triplets[*i];
+
+					if (indices.size() > row_start && indices.back() == triplet.column) {
+						accumulate(values.back(), triplet.value);
+					} else {
+						indices.push_back(static_cast<IndexT>(triplet.column));
+						values.push_back(triplet.value);
+					}
+				}
+
+				offsets[r + 1] = indices.size();
+			}
+		}
+	}
+
+	/// A sparse matrix in compressed sparse row (CSR) format.
+	template <typename NumericT = RealT>
+	class SparseMatrix
+	{
+	public:
+		typedef Sparse::IndexT IndexT;
+
+		SparseMatrix() : _offsets(1, 0) {}
+
+		/// An empty matrix of the given size.
+		SparseMatrix(std::size_t rows, std::size_t columns) : _rows(rows), _columns(columns), _offsets(rows + 1, 0) {}
+
+		/// Assemble a matrix from triplets. Duplicate entries are summed.
+		SparseMatrix(std::size_t rows, std::size_t columns, const std::vector<Triplet<NumericT>> & triplets) : _rows(rows), _columns(columns)
+		{
+			Sparse::assemble(rows, columns, triplets.data(), triplets.size(), _offsets, _indices, _values);
+		}
+
+		std::size_t rows() const {return _rows;}
+		std::size_t columns() const {return _columns;}
+
+		/// The number of stored entries.
+		std::size_t non_zeros() const {return _indices.size();}
+
+		/// The entries of row r are in [offsets()[r], offsets()[r+1]).
+		const std::vector<std::size_t> & offsets() const {return _offsets;}
+		const std::vector<IndexT> & indices() const {return _indices;}
+		const Sparse::StorageT<NumericT> & values() const {return _values;}
+		Sparse::StorageT<NumericT> & values() {return _values;}
+
+		/// Look up a single entry. Entries which are not stored are zero.
+		NumericT at(std::size_t r, std::size_t c) const
+		{
+			assert(r < _rows && c < _columns);
+
+			auto begin = _indices.begin() + _offsets[r], end = _indices.begin() + _offsets[r + 1];
+			auto i = std::lower_bound(begin, end, c);
+
+			if (i != end && *i == c)
+				return _values[i - _indices.begin()];
+
+			return 0;
+		}
+
+		SparseMatrix transpose() const
+		{
+			std::vector<Triplet<NumericT>> triplets;
+			triplets.reserve(non_zeros());
+
+			for (std::size_t r = 0; r < _rows; r += 1)
+				for (std::size_t k = _offsets[r]; k < _offsets[r + 1]; k += 1)
+					triplets.push_back({_indices[k], r, _values[k]});
+
+			return SparseMatrix(_columns, _rows, triplets);
+		}
+
+		DynamicMatrix<NumericT> dense() const
+		{
+			DynamicMatrix<NumericT> result(_rows, _columns);
+
+			for (std::size_t r = 0; r < _rows; r += 1)
+				for (std::size_t k = _offsets[r]; k < _offsets[r + 1]; k += 1)
+					result.at(r, _indices[k]) = _values[k];
+
+			return result;
+		}
+
+	private:
+		std::size_t _rows = 0, _columns = 0;
+
+		std::vector<std::size_t> _offsets;
+		std::vector<IndexT> _indices;
+		Sparse::StorageT<NumericT> _values;
+	};
+
+	/// Sparse matrix-vector multiply for rows [begin, end): result += left * right. Each row is accumulated with two independent sums.
+	template <typename NumericT>
+	void multiply(NumericT * result, const SparseMatrix<NumericT> & left, const NumericT * right, std::size_t begin, std::size_t end)
+	{
+		const auto & offsets = left.offsets();
+		const auto * indices = left.indices().data();
+		const auto * values = left.values().data();
+
+		for (std::size_t r = begin; r < end; r += 1) {
+			NumericT s0 = 0, s1 = 0;
+			std::size_t k = offsets[r], last = offsets[r + 1];
+
+			for (; k + 2 <= last; k += 2) {
+				s0 += values[k] * right[indices[k]];
+				s1 += values[k+1] * right[indices[k+1]];
+			}
+
+			if (k < last)
+				s0 += values[k] * right[indices[k]];
+
+			result[r] += s0 + s1;
+		}
+	}
+
+	/// Transposed sparse matrix-vector multiply for rows [begin, end) of left: result += transpose(left) * right.
+	template <typename NumericT>
+	void multiply_transpose(NumericT * result, const SparseMatrix<NumericT> & left, const NumericT * right, std::size_t begin, std::size_t end)
+	{
+		const auto & offsets = left.offsets();
+		const auto * indices = left.indices().data();
+		const auto * values = left.values().data();
+
+		for (std::size_t r = begin; r < end; r += 1) {
+			NumericT x = right[r];
+
+			for (std::size_t k = offsets[r]; k < offsets[r + 1]; k += 1)
+				result[indices[k]] += values[k] * x;
+		}
+	}
+
+	template <typename NumericT>
+	void multiply(DynamicVector<NumericT> & result, const SparseMatrix<NumericT> & left, const DynamicVector<NumericT> & right)
+	{
+		assert(left.rows() == result.size() && left.columns() == right.size());
+
+		multiply(result.data(), left, right.data(), 0, left.rows());
+	}
+
+	template <typename NumericT>
+	void multiply_transpose(DynamicVector<NumericT> & result, const SparseMatrix<NumericT> & left, const DynamicVector<NumericT> & right)
+	{
+		assert(left.columns() == result.size() && left.rows() == right.size());
+
+		multiply_transpose(result.data(), left, right.data(), 0, left.rows());
+	}
+
+	/// Short hand for sparse matrix-vector multiplication.
+	template <typename NumericT>
+	DynamicVector<NumericT> operator*(const SparseMatrix<NumericT> & left, const DynamicVector<NumericT> & right)
+	{
+		DynamicVector<NumericT> result(left.rows());
+
+		multiply(result, left, right);
+
+		return result;
+	}
+
+	extern template class SparseMatrix<float>;
+	extern template class SparseMatrix<double>;
+}
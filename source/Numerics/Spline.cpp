@@ -0,0 +1,16 @@
+//
+//  Spline.cpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Spline.hpp"
+
+namespace Numerics
+{
+	template class Spline<2, float>;
+	template class Spline<3, float>;
+	template class Spline<3, double>;
+}
@@ -0,0 +1,314 @@
+//
+//  Spline.hpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "Vector.hpp"
+#include "Polynomial.hpp"
+
+#include <vector>
+#include <algorithm>
+#include <cassert>
+
+namespace Numerics
+{
+	/// A piecewise cubic curve. Every kind of spline is converted to the power basis once, so evaluation doesn't depend on how the curve was constructed. The parameter u runs from 0 to size(), and segment i covers [i, i+1].
+	template <std::size_t D, typename NumericT = RealT>
+	class Spline
+	{
+	public:
+		typedef Vector<D, NumericT> VectorT;
+
+		/// A cubic segment p(t) = c[0] + c[1] t + c[2] t^2 + c[3] t^3 for t in [0, 1].
+		struct Segment : public Polynomial<4, VectorT, NumericT>
+		{
+			typedef Polynomial<4, VectorT, NumericT> PolynomialT;
+
+			Segment() {}
+			Segment(const PolynomialT & polynomial) : PolynomialT(polynomial) {}
+
+			VectorT position(const NumericT & t) const
+			{
+				return (*this)(t);
+			}
+
+			VectorT tangent(const NumericT & t) const
+			{
+				const auto & c = this->coefficients;
+
+				return (c[3] * (3 * t) + c[2] * 2) * t + c[1];
+			}
+
+			/// The segment from p0 to p1 with tangents m0 and m1.
+			static Segment hermite(const VectorT & p0, const VectorT & m0, const VectorT & p1, const VectorT & m1)
+			{
+				return PolynomialT::hermite(p0, m0, p1, m1);
+			}
+
+			/// The segment from p0 to p3 with control points p1 and p2.
+			static Segment bezier(const VectorT & p0, const VectorT & p1, const VectorT & p2, const VectorT & p3)
+			{
+				return PolynomialT::bezier(p0, p1, p2, p3);
+			}
+		};
+
+		Spline() {}
+		Spline(std::vector<Segment> segments) : _segments(std::move(segments)) {}
+
+		/// A uniform Catmull-Rom spline passing through every point. The tangents at the end points are the differences to their neighbours.
+		static Spline catmull_rom(const std::vector<VectorT> & points)
+		{
+			assert(points.size() >= 2);
+
+			std::size_t last = points.size() - 1;
+			std::vector<VectorT> tangents(points.size());
+
+			tangents[0] = points[1] - points[0];
+			tangents[last] = points[last] - points[last-1];
+
+			for (std::size_t i = 1; i < last; i += 1)
+				tangents[i] = (points[i+1] - points[i-1]) * NumericT(0.5);
+
+			return hermite(points, tangents);
+		}
+
+		/// A piecewise cubic Bézier curve, given 3n + 1 control points where every third point is on the curve.
+		static Spline bezier(const std::vector<VectorT> & points)
+		{
+			assert(points.size() >= 4 && (points.size() - 1) % 3 == 0);
+
+			std::vector<Segment> segments;
+
+			for (std::size_t i = 0; i + 3 < points.size(); i += 3)
+				segments.push_back(Segment::bezier(points[i], points[i+1], points[i+2], points[i+3]));
+
+			return segments;
+		}
+
+		/// A spline through every point, with the given tangent at each point.
+		static Spline hermite(const std::vector<VectorT> & points, const std::vector<VectorT> & tangents)
+		{
+			assert(points.size() >= 2 && points.size() == tangents.size());
+
+			std::vector<Segment> segments;
+
+			for (std::size_t i = 0; i + 1 < points.size(); i += 1)
+				segments.push_back(Segment::hermite(points[i], tangents[i], points[i+1], tangents[i+1]));
+
+			return segments;
+		}
+
+		/// The natural cubic spline through every point, which has a continuous second derivative and zero curvature at the ends. The tangents are the solution of a tridiagonal system, which is solved directly using the Thomas algorithm.
+		static Spline natural_cubic(const std::vector<VectorT> & points)
+		{
+			assert(points.size() >= 2);
+
+			std::size_t count = points.size(), last = count - 1;
+
+			// The system is: 2 m[0] + m[1] = 3 (p[1] - p[0]), m[i-1] + 4 m[i] + m[i+1] = 3 (p[i+1] - p[i-1]), and m[n-2] + 2 m[n-1] = 3 (p[n-1] - p[n-2]).
+			std::vector<NumericT> upper(count);
+			std::vector<VectorT> tangents(count);
+
+			// Forward elimination, with the sub-diagonal and upper diagonal being 1:
+			NumericT diagonal = 2;
+			upper[0] = 1 / diagonal;
+			tangents[0] = (points[1] - points[0]) * (3 / diagonal);
+
+			for (std::size_t i = 1; i < count; i += 1) {
+				VectorT right = (i == last) ? (points[i] - points[i-1]) * 3 : (points[i+1] - points[i-1]) * 3;
+				diagonal = ((i == last) ? 2 : 4) - upper[i-1];
+
+				upper[i] = 1 / diagonal;
+				tangents[i] = (right - tangents[i-1]) * upper[i];
+			}
+
+			// Back substitution:
+			for (std::size_t i = last; i-- > 0;)
+				tangents[i] -= tangents[i+1] * upper[i];
+
+			return hermite(points, tangents);
+		}
+
+		/// The number of segments.
+		std::size_t size() const { return _segments.size(); }
+
+		const std::vector<Segment> & segments() const { return _segments; }
+
+		/// The segment containing u, and the parameter within it. Parameters outside [0, size()] are clamped.
+		const Segment & locate(NumericT u, NumericT & t) const
+		{
+			assert(!_segments.empty());
+
+			u = std::max<NumericT>(0, std::min<NumericT>(u, _segments.size()));
+
+			std::size_t index = std::min<std::size_t>(static_cast<std::size_t>(u), _segments.size() - 1);
+			t = u - index;
+
+			return _segments[index];
+		}
+
+		VectorT position(const NumericT & u) const
+		{
+			NumericT t;
+			return locate(u, t).position(t);
+		}
+
+		VectorT tangent(const NumericT & u) const
+		{
+			NumericT t;
+			return locate(u, t).tangent(t);
+		}
+
+		/// Evaluate the positions, and optionally the tangents, at the given parameters.
+		void evaluate(std::size_t count, const NumericT * parameters, VectorT * positions, VectorT * tangents = nullptr) const
+		{
+			for (std::size_t i = 0; i < count; i += 1) {
+				NumericT t;
+				const Segment & segment = locate(parameters[i], t);
+
+				positions[i] = segment.position(t);
+				if (tangents) tangents[i] = segment.tangent(t);
+			}
+		}
+
+		/// Evaluate the positions, and optionally the tangents, at the uniformly spaced parameters start + i * step. Within each segment, successive samples are computed by forward differencing, see Polynomial::evaluate_uniform.
+		void evaluate_uniform(std::size_t count, NumericT start, NumericT step, VectorT * positions, VectorT * tangents = nullptr) const
+		{
+			std::size_t i = 0;
+
+			while (i < count) {
+				NumericT u = start + step * i, t;
+				const Segment & segment = locate(u, t);
+
+				// The number of samples which fall in this segment, i.e. until the parameter crosses the next segment boundary. Samples outside the curve are clamped, so they are evaluated individually:
+				std::size_t index = &segment - _segments.data(), run = 1;
+
+				while (u >= 0 && u <= NumericT(_segments.size()) && i + run < count) {
+					NumericT next = start + step * (i + run);
+
+					if (next < NumericT(index) || next >= NumericT(index + 1)) break;
+
+					run += 1;
+				}
+
+				forward_differences(segment, t, step, run, positions + i, tangents ? tangents + i : nullptr);
+
+				i += run;
+			}
+		}
+
+		/// The total arc length of the curve.
+		NumericT length() const
+		{
+			if (_distances.empty()) prepare();
+
+			return _distances.back();
+		}
+
+		/// Build the table used for arc length parameterization, with the given number of intervals per segment. This is done lazily by the functions which need it, but as that modifies the table, it should be done first if those functions will be called concurrently.
+		void prepare(std::size_t intervals = 16) const
+		{
+			assert(intervals > 0);
+
+			if (_intervals == intervals && !_distances.empty()) return;
+
+			_intervals = intervals;
+			_distances.assign(1, 0);
+			_distances.reserve(_segments.size() * intervals + 1);
+
+			NumericT width = NumericT(1) / intervals;
+
+			for (const auto & segment : _segments) {
+				for (std::size_t j = 0; j < intervals; j += 1)
+					_distances.push_back(_distances.back() + arc_length(segment, j * width, (j + 1) * width));
+			}
+		}
+
+		/// The parameter at the given arc length along the curve. Distances outside [0, length()] are clamped.
+		NumericT parameter_at(NumericT distance) const
+		{
+			assert(!_segments.empty());
+
+			if (_distances.empty()) prepare();
+
+			distance = std::max<NumericT>(0, std::min(distance, _distances.back()));
+
+			// The interval containing the distance:
+			auto next = std::upper_bound(_distances.begin() + 1, _distances.end() - 1, distance);
+			std::size_t interval = (next - _distances.begin()) - 1;
+
+			NumericT start = _distances[interval], width = _distances[interval+1] - start;
+			NumericT fraction = width > 0 ? (distance - start) / width : 0;
+
+			std::size_t index = interval / _intervals;
+			const Segment & segment = _segments[index];
+
+			NumericT a = NumericT(interval % _intervals) / _intervals;
+			NumericT t = a + fraction / _intervals;
+
+			// The speed within an interval is almost constant, so Newton's method quickly refines the interpolated estimate:
+			for (std::size_t i = 0; i < 2; i += 1) {
+				NumericT speed = segment.tangent(t).length();
+
+				if (speed > 0)
+					t -= (start + arc_length(segment, a, t) - distance) / speed;
+			}
+
+			return index + t;
+		}
+
+		VectorT position_at(const NumericT & distance) const
+		{
+			return position(parameter_at(distance));
+		}
+
+		/// Evaluate the positions, and optionally the unit tangents, at the given arc lengths, which is constant speed motion when the distances increase uniformly.
+		void evaluate_at(std::size_t count, const NumericT * distances, VectorT * positions, VectorT * tangents = nullptr) const
+		{
+			for (std::size_t i = 0; i < count; i += 1) {
+				NumericT t;
+				const Segment & segment = locate(parameter_at(distances[i]), t);
+
+				positions[i] = segment.position(t);
+				if (tangents) tangents[i] = segment.tangent(t).normalize();
+			}
+		}
+
+	private:
+		std::vector<Segment> _segments;
+
+		mutable std::size_t _intervals = 0;
+		mutable std::vector<NumericT> _distances;
+
+		/// The length of a segment between parameters a and b, using 5 point Gauss-Legendre quadrature of the speed.
+		static NumericT arc_length(const Segment & segment, NumericT a, NumericT b)
+		{
+			static const NumericT NODES[5] = {0, -0.538469310105683091, 0.538469310105683091, -0.906179845938663993, 0.906179845938663993};
+			static const NumericT WEIGHTS[5] = {0.568888888888888889, 0.478628670499366468, 0.478628670499366468, 0.236926885056189088, 0.236926885056189088};
+
+			NumericT half = (b - a) / 2, middle = (a + b) / 2, sum = 0;
+
+			for (std::size_t i = 0; i < 5; i += 1)
+				sum += segment.tangent(middle + half * NODES[i]).length() * WEIGHTS[i];
+
+			return sum * half;
+		}
+
+		static void forward_differences(const Segment & segment, NumericT t, NumericT h, std::size_t count, VectorT * positions, VectorT * tangents)
+		{
+			segment.evaluate_uniform(count, t, h, positions);
+
+			if (tangents)
+				segment.derivative().evaluate_uniform(count, t, h, tangents);
+		}
+	};
+
+	extern template class Spline<2, float>;
+	extern template class Spline<3, float>;
+	extern template class Spline<3, double>;
+}
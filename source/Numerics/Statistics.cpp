@@ -0,0 +1,17 @@
+//
+//  Statistics.cpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Statistics.hpp"
+
+namespace Numerics
+{
+	template class Statistics<3, float>;
+	template class Statistics<3, double>;
+	template class Statistics<6, float>;
+	template class Statistics<6, double>;
+}
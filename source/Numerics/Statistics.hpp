@@ -0,0 +1,231 @@
+//
+//  Statistics.hpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "Vector.hpp"
+#include "Matrix.hpp"
+#include "Summation.hpp"
+
+#include <limits>
+#include <algorithm>
+
+#include "Statistics/SSE.hpp"
+
+namespace Numerics
+{
+	template <std::size_t D, typename NumericT>
+	class Statistics;
+
+	/// Computes the statistics of a block of samples in two passes, first the mean and bounds, then the products of the deviations from the mean. The block should be small enough to stay in the cache between passes. This is specialized where SIMD is available.
+	template <std::size_t D, typename NumericT>
+	struct Moments
+	{
+		typedef Vector<D, NumericT> VectorT;
+		typedef Matrix<D, D, NumericT> MatrixT;
+
+		static Statistics<D, NumericT> compute(const VectorT * values, std::size_t count)
+		{
+			VectorT mean(ZERO), minimum = values[0], maximum = values[0];
+			MatrixT products(ZERO);
+
+			for (std::size_t k = 0; k < count; k += 1) {
+				for (std::size_t i = 0; i < D; i += 1) {
+					NumericT value = values[k][i];
+
+					mean[i] += value;
+					minimum[i] = std::min(minimum[i], value);
+					maximum[i] = std::max(maximum[i], value);
+				}
+			}
+
+			for (std::size_t i = 0; i < D; i += 1)
+				mean[i] /= NumericT(count);
+
+			for (std::size_t k = 0; k < count; k += 1) {
+				NumericT deviation[D];
+
+				for (std::size_t i = 0; i < D; i += 1)
+					deviation[i] = values[k][i] - mean[i];
+
+				// The products are symmetric, so only the upper triangle is accumulated:
+				for (std::size_t j = 0; j < D; j += 1)
+					for (std::size_t i = 0; i <= j; i += 1)
+						products[j*D + i] += deviation[i] * deviation[j];
+			}
+
+			for (std::size_t j = 0; j < D; j += 1)
+				for (std::size_t i = j + 1; i < D; i += 1)
+					products[j*D + i] = products[i*D + j];
+
+			return {count, mean, products, minimum, maximum};
+		}
+	};
+
+	/// The mean, covariance and bounds of a stream of vectors, computed in a single pass without storing the samples. Samples are added using Welford's algorithm, and partial results are merged using Chan's algorithm, so that a stream can be split between threads and combined afterwards.
+	template <std::size_t D, typename NumericT = RealT>
+	class Statistics
+	{
+	public:
+		typedef Vector<D, NumericT> VectorT;
+		typedef Matrix<D, D, NumericT> MatrixT;
+
+		/// Samples are added in blocks of this size by the batch update.
+		static constexpr std::size_t BLOCK = 256;
+
+		/// The statistics of an empty stream.
+		Statistics() : _count(0), _mean(ZERO), _products(ZERO), _minimum(std::numeric_limits<NumericT>::max()), _maximum(std::numeric_limits<NumericT>::lowest()) {}
+
+		/// The statistics of count samples, where products is the sum of the outer products of the deviations from the mean.
+		Statistics(std::size_t count, const VectorT & mean, const MatrixT & products, const VectorT & minimum, const VectorT & maximum) : _count(count), _mean(mean), _products(products), _minimum(minimum), _maximum(maximum) {}
+
+		std::size_t count() const { return _count; }
+		bool empty() const { return _count == 0; }
+
+		const VectorT & mean() const { return _mean; }
+
+		/// The sum of the outer products of the deviations from the mean.
+		const MatrixT & products() const { return _products; }
+
+		/// The lower and upper corners of the bounding box of the samples.
+		const VectorT & minimum() const { return _minimum; }
+		const VectorT & maximum() const { return _maximum; }
+
+		/// The covariance matrix. The sample covariance divides by count - 1, and the population covariance by count. It is zero if there are too few samples.
+		MatrixT covariance(bool sample = true) const
+		{
+			MatrixT result;
+			NumericT scale = divisor(sample);
+
+			for (std::size_t i = 0; i < D*D; i += 1)
+				result[i] = _products[i] * scale;
+
+			return result;
+		}
+
+		/// The diagonal of the covariance matrix.
+		VectorT variance(bool sample = true) const
+		{
+			VectorT result;
+			NumericT scale = divisor(sample);
+
+			for (std::size_t i = 0; i < D; i += 1)
+				result[i] = _products.at(i, i) * scale;
+
+			return result;
+		}
+
+		/// Add a single sample.
+		Statistics & add(const VectorT & value)
+		{
+			_count += 1;
+
+			VectorT deviation = value - _mean;
+			_mean += deviation / NumericT(_count);
+
+			// The product of the deviations from the old and new means, which is symmetric:
+			accumulate(deviation, NumericT(_count - 1) / NumericT(_count));
+
+			_minimum = _minimum.constrain(value, false);
+			_maximum = _maximum.constrain(value, true);
+
+			return *this;
+		}
+
+		/// Add an array of samples. Each block is reduced in two passes, which is faster and more accurate than adding the samples one at a time, and then merged.
+		Statistics & add(const VectorT * values, std::size_t count)
+		{
+			for (std::size_t offset = 0; offset < count; offset += BLOCK)
+				merge(Moments<D, NumericT>::compute(values + offset, std::min(BLOCK, count - offset)));
+
+			return *this;
+		}
+
+		/// Combine the statistics of another stream, as if its samples had been added to this one. Merging is associative, so partial results may be combined in any grouping.
+		Statistics & merge(const Statistics & other)
+		{
+			if (other._count == 0) return *this;
+			if (_count == 0) return *this = other;
+
+			std::size_t count = _count + other._count;
+			VectorT delta = other._mean - _mean;
+
+			_mean += delta * (NumericT(other._count) / NumericT(count));
+
+			for (std::size_t i = 0; i < D*D; i += 1)
+				_products[i] += other._products[i];
+
+			accumulate(delta, NumericT(_count) * NumericT(other._count) / NumericT(count));
+
+			_minimum = _minimum.constrain(other._minimum, false);
+			_maximum = _maximum.constrain(other._maximum, true);
+
+			_count = count;
+
+			return *this;
+		}
+
+		Statistics & operator+=(const Statistics & other)
+		{
+			return merge(other);
+		}
+
+		Statistics operator+(const Statistics & other) const
+		{
+			return Statistics(*this).merge(other);
+		}
+
+	private:
+		std::size_t _count;
+		VectorT _mean;
+		MatrixT _products;
+		VectorT _minimum, _maximum;
+
+		NumericT divisor(bool sample) const
+		{
+			std::size_t count = _count;
+			if (sample && count > 0) count -= 1;
+
+			return count > 0 ? 1 / NumericT(count) : 0;
+		}
+
+		// products += scale * delta * delta^T
+		void accumulate(const VectorT & delta, const NumericT & scale)
+		{
+			for (std::size_t j = 0; j < D; j += 1) {
+				NumericT factor = delta[j] * scale;
+
+				for (std::size_t i = 0; i < D; i += 1)
+					_products[j*D + i] += delta[i] * factor;
+			}
+		}
+	};
+
+#ifdef NUMERICS_STATISTICS_SSE
+	template <>
+	struct Moments<3, float>
+	{
+		static Statistics<3, float> compute(const Vector<3, float> * values, std::size_t count)
+		{
+			static_assert(sizeof(Vector<3, float>) == sizeof(float) * 3, "Vectors must be packed!");
+
+			Vector<3, float> mean, minimum, maximum;
+			Matrix<3, 3, float> products;
+
+			moments_3(values[0].data(), count, mean.data(), products.data(), minimum.data(), maximum.data());
+
+			return {count, mean, products, minimum, maximum};
+		}
+	};
+#endif
+
+	extern template class Statistics<3, float>;
+	extern template class Statistics<3, double>;
+	extern template class Statistics<6, float>;
+	extern template class Statistics<6, double>;
+}
@@ -0,0 +1,118 @@
+//
+//  SSE.cpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "SSE.hpp"
+
+#ifdef NUMERICS_STATISTICS_SSE
+
+#include "../Vector/SSE.hpp"
+
+#include <xmmintrin.h>
+#include <algorithm>
+
+namespace Numerics
+{
+	namespace
+	{
+		inline float horizontal_sum(__m128 v)
+		{
+			float lanes[4];
+			_mm_storeu_ps(lanes, v);
+
+			return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+		}
+
+		inline float horizontal_minimum(__m128 v)
+		{
+			float lanes[4];
+			_mm_storeu_ps(lanes, v);
+
+			return std::min(std::min(lanes[0], lanes[1]), std::min(lanes[2], lanes[3]));
+		}
+
+		inline float horizontal_maximum(__m128 v)
+		{
+			float lanes[4];
+			_mm_storeu_ps(lanes, v);
+
+			return std::max(std::max(lanes[0], lanes[1]), std::max(lanes[2], lanes[3]));
+		}
+	}
+
+	void moments_3(const float * values, std::size_t count, float * mean, float * products, float * minimum, float * maximum)
+	{
+		// Four samples at a time, with one register per component:
+		std::size_t blocks = count / 4, tail = blocks * 4;
+		__m128 x, y, z;
+
+		// The first pass computes the sums and bounds:
+		__m128 sx = _mm_setzero_ps(), sy = _mm_setzero_ps(), sz = _mm_setzero_ps();
+		__m128 lx = _mm_set1_ps(values[0]), ly = _mm_set1_ps(values[1]), lz = _mm_set1_ps(values[2]);
+		__m128 ux = lx, uy = ly, uz = lz;
+
+		for (std::size_t k = 0; k < blocks; k += 1) {
+			const float * p = values + k * 12;
+			deinterleave(_mm_loadu_ps(p), _mm_loadu_ps(p + 4), _mm_loadu_ps(p + 8), x, y, z);
+
+			sx = _mm_add_ps(sx, x); sy = _mm_add_ps(sy, y); sz = _mm_add_ps(sz, z);
+			lx = _mm_min_ps(lx, x); ly = _mm_min_ps(ly, y); lz = _mm_min_ps(lz, z);
+			ux = _mm_max_ps(ux, x); uy = _mm_max_ps(uy, y); uz = _mm_max_ps(uz, z);
+		}
+
+		float sum[3] = {horizontal_sum(sx), horizontal_sum(sy), horizontal_sum(sz)};
+
+		minimum[0] = horizontal_minimum(lx); minimum[1] = horizontal_minimum(ly); minimum[2] = horizontal_minimum(lz);
+		maximum[0] = horizontal_maximum(ux); maximum[1] = horizontal_maximum(uy); maximum[2] = horizontal_maximum(uz);
+
+		for (std::size_t k = tail; k < count; k += 1) {
+			for (std::size_t i = 0; i < 3; i += 1) {
+				float value = values[k*3 + i];
+
+				sum[i] += value;
+				minimum[i] = std::min(minimum[i], value);
+				maximum[i] = std::max(maximum[i], value);
+			}
+		}
+
+		for (std::size_t i = 0; i < 3; i += 1)
+			mean[i] = sum[i] / count;
+
+		// The second pass computes the products of the deviations, of which 6 are unique:
+		__m128 mx = _mm_set1_ps(mean[0]), my = _mm_set1_ps(mean[1]), mz = _mm_set1_ps(mean[2]);
+		__m128 xx = _mm_setzero_ps(), xy = _mm_setzero_ps(), xz = _mm_setzero_ps(), yy = _mm_setzero_ps(), yz = _mm_setzero_ps(), zz = _mm_setzero_ps();
+
+		for (std::size_t k = 0; k < blocks; k += 1) {
+			const float * p = values + k * 12;
+			deinterleave(_mm_loadu_ps(p), _mm_loadu_ps(p + 4), _mm_loadu_ps(p + 8), x, y, z);
+
+			x = _mm_sub_ps(x, mx); y = _mm_sub_ps(y, my); z = _mm_sub_ps(z, mz);
+
+			xx = _mm_add_ps(xx, _mm_mul_ps(x, x));
+			xy = _mm_add_ps(xy, _mm_mul_ps(x, y));
+			xz = _mm_add_ps(xz, _mm_mul_ps(x, z));
+			yy = _mm_add_ps(yy, _mm_mul_ps(y, y));
+			yz = _mm_add_ps(yz, _mm_mul_ps(y, z));
+			zz = _mm_add_ps(zz, _mm_mul_ps(z, z));
+		}
+
+		float unique[6] = {horizontal_sum(xx), horizontal_sum(xy), horizontal_sum(xz), horizontal_sum(yy), horizontal_sum(yz), horizontal_sum(zz)};
+
+		for (std::size_t k = tail; k < count; k += 1) {
+			float dx = values[k*3] - mean[0], dy = values[k*3+1] - mean[1], dz = values[k*3+2] - mean[2];
+
+			unique[0] += dx * dx; unique[1] += dx * dy; unique[2] += dx * dz;
+			unique[3] += dy * dy; unique[4] += dy * dz; unique[5] += dz * dz;
+		}
+
+		products[0] = unique[0]; products[1] = unique[1]; products[2] = unique[2];
+		products[3] = unique[1]; products[4] = unique[3]; products[5] = unique[4];
+		products[6] = unique[2]; products[7] = unique[4]; products[8] = unique[5];
+	}
+}
+
+#endif
@@ -0,0 +1,23 @@
+//
+//  SSE.hpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#ifdef __SSE2__
+
+#define NUMERICS_STATISTICS_SSE
+
+#include <cstddef>
+
+namespace Numerics
+{
+	// The mean, bounds and sum of the outer products of the deviations from the mean of count packed 3-component float vectors. The products are stored as a column major 3x3 matrix:
+	void moments_3(const float * values, std::size_t count, float * mean, float * products, float * minimum, float * maximum);
+}
+
+#endif
@@ -0,0 +1,300 @@
+//
+//  Summation.hpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "Number.hpp"
+
+#include <cstddef>
+#include <cassert>
+
+#include "Summation/SSE.hpp"
+
+namespace Numerics
+{
+	/// How a sum of many terms is accumulated. Every policy adds the terms in a fixed order, so results don't vary between runs.
+	enum Summation {
+		/// A single accumulator, adding each term in order. The error grows linearly with the number of terms, and every addition depends on the previous one.
+		SERIAL,
+		/// Four independent accumulators, which are added together at the end. The error is similar to SERIAL, but the additions can run in parallel and use SIMD.
+		UNROLLED,
+		/// Recursively sum each half of the terms, so the error grows with the logarithm of the number of terms.
+		PAIRWISE,
+		/// Each accumulator also sums the rounding error of every addition, so the error doesn't depend on the number of terms. The result is about as accurate as summing in twice the precision.
+		COMPENSATED
+	};
+
+	/// The sum s = a + b and its rounding error e, such that a + b = s + e exactly. The arguments are copied, so s may be the same as a or b. This requires strict floating point semantics, and doesn't work with -ffast-math.
+	template <typename ValueT>
+	inline void two_sum(ValueT a, ValueT b, ValueT & s, ValueT & e)
+	{
+		s = a + b;
+
+		ValueT z = s - a;
+		e = (a - (s - z)) + (b - z);
+	}
+
+	/// The product p = a * b and its rounding error e. Types other than float and double are assumed to multiply exactly.
+	template <typename ValueT>
+	inline void two_product(const ValueT & a, const ValueT & b, ValueT & p, ValueT & e)
+	{
+		p = a * b;
+		e = ValueT(ZERO);
+	}
+
+	/// Dekker's algorithm, which splits each factor into halves whose products are exact.
+	template <typename FloatT, std::size_t BITS>
+	inline void split_product(const FloatT & a, const FloatT & b, FloatT & p, FloatT & e)
+	{
+		const FloatT FACTOR = FloatT((1ULL << BITS) + 1);
+
+		FloatT c = FACTOR * a, a_high = c - (c - a), a_low = a - a_high;
+		FloatT d = FACTOR * b, b_high = d - (d - b), b_low = b - b_high;
+
+		p = a * b;
+		e = ((a_high * b_high - p) + a_high * b_low + a_low * b_high) + a_low * b_low;
+	}
+
+	inline void two_product(const float & a, const float & b, float & p, float & e)
+	{
+		split_product<float, 12>(a, b, p, e);
+	}
+
+	inline void two_product(const double & a, const double & b, double & p, double & e)
+	{
+		split_product<double, 27>(a, b, p, e);
+	}
+
+	/// Sums term(i) for i in [begin, end) using the given policy.
+	template <Summation SUMMATION>
+	struct Accumulate;
+
+	template <>
+	struct Accumulate<SERIAL>
+	{
+		template <typename ValueT, typename TermT>
+		static ValueT sum(std::size_t begin, std::size_t end, const TermT & term)
+		{
+			ValueT s(ZERO);
+
+			for (std::size_t i = begin; i < end; i += 1)
+				s = s + term(i);
+
+			return s;
+		}
+	};
+
+	template <>
+	struct Accumulate<UNROLLED>
+	{
+		template <typename ValueT, typename TermT>
+		static ValueT sum(std::size_t begin, std::size_t end, const TermT & term)
+		{
+			ValueT s0(ZERO), s1(ZERO), s2(ZERO), s3(ZERO);
+			std::size_t i = begin;
+
+			for (; i + 4 <= end; i += 4) {
+				s0 = s0 + term(i+0);
+				s1 = s1 + term(i+1);
+				s2 = s2 + term(i+2);
+				s3 = s3 + term(i+3);
+			}
+
+			for (; i < end; i += 1)
+				s0 = s0 + term(i);
+
+			return (s0 + s1) + (s2 + s3);
+		}
+	};
+
+	template <>
+	struct Accumulate<PAIRWISE>
+	{
+		/// Blocks of this size are summed with independent accumulators, which doesn't increase the error much but avoids the overhead of recursing to single terms.
+		static constexpr std::size_t BLOCK = 64;
+
+		template <typename ValueT, typename TermT>
+		static ValueT sum(std::size_t begin, std::size_t end, const TermT & term)
+		{
+			if (end - begin <= BLOCK)
+				return Accumulate<UNROLLED>::sum<ValueT>(begin, end, term);
+
+			std::size_t middle = begin + (end - begin) / 2;
+
+			return sum<ValueT>(begin, middle, term) + sum<ValueT>(middle, end, term);
+		}
+	};
+
+	template <>
+	struct Accumulate<COMPENSATED>
+	{
+		/// Add the value to the sum, and its rounding error to the compensation.
+		template <typename ValueT>
+		static void add(ValueT & s, ValueT & c, const ValueT & value)
+		{
+			ValueT e;
+			two_sum(s, value, s, e);
+			c = c + e;
+		}
+
+		template <typename ValueT, typename TermT>
+		static ValueT sum(std::size_t begin, std::size_t end, const TermT & term)
+		{
+			ValueT s0(ZERO), s1(ZERO), c0(ZERO), c1(ZERO);
+			std::size_t i = begin;
+
+			for (; i + 2 <= end; i += 2) {
+				add(s0, c0, term(i+0));
+				add(s1, c1, term(i+1));
+			}
+
+			for (; i < end; i += 1)
+				add(s0, c0, term(i));
+
+			add(s0, c0, s1);
+
+			return s0 + (c0 + c1);
+		}
+	};
+
+	/// Sums and inner products of arrays. These are specialized where SIMD is available.
+	template <Summation SUMMATION, typename ValueT>
+	struct Summator
+	{
+		static ValueT sum(std::size_t size, const ValueT * x)
+		{
+			return Accumulate<SUMMATION>::template sum<ValueT>(0, size, [x](std::size_t i) {return x[i];});
+		}
+
+		static ValueT dot(std::size_t size, const ValueT * x, const ValueT * y)
+		{
+			return Accumulate<SUMMATION>::template sum<ValueT>(0, size, [x, y](std::size_t i) {return x[i] * y[i];});
+		}
+	};
+
+	/// The compensated inner product also accounts for the rounding error of each product (Ogita, Rump and Oishi's Dot2).
+	template <typename ValueT>
+	struct Summator<COMPENSATED, ValueT>
+	{
+		static ValueT sum(std::size_t size, const ValueT * x)
+		{
+			return Accumulate<COMPENSATED>::template sum<ValueT>(0, size, [x](std::size_t i) {return x[i];});
+		}
+
+		static ValueT dot(std::size_t size, const ValueT * x, const ValueT * y)
+		{
+			ValueT s(ZERO), c(ZERO);
+
+			for (std::size_t i = 0; i < size; i += 1) {
+				ValueT p, e;
+				two_product(x[i], y[i], p, e);
+
+				Accumulate<COMPENSATED>::add(s, c, p);
+				c = c + e;
+			}
+
+			return s + c;
+		}
+	};
+
+#ifdef NUMERICS_SUMMATION_SSE
+	template <>
+	struct Summator<UNROLLED, float>
+	{
+		static float sum(std::size_t size, const float * x) {return sum_unrolled(size, x);}
+		static float dot(std::size_t size, const float * x, const float * y) {return dot_unrolled(size, x, y);}
+	};
+
+	template <>
+	struct Summator<COMPENSATED, float>
+	{
+		static float sum(std::size_t size, const float * x) {return sum_compensated(size, x);}
+		static float dot(std::size_t size, const float * x, const float * y) {return dot_compensated(size, x, y);}
+	};
+#endif
+
+	/// The sum of x. The values may be scalars or vectors.
+	template <Summation SUMMATION = UNROLLED, typename ValueT>
+	ValueT sum(std::size_t size, const ValueT * x)
+	{
+		return Summator<SUMMATION, ValueT>::sum(size, x);
+	}
+
+	/// The inner product of x and y.
+	template <Summation SUMMATION = UNROLLED, typename ValueT>
+	ValueT dot(std::size_t size, const ValueT * x, const ValueT * y)
+	{
+		return Summator<SUMMATION, ValueT>::dot(size, x, y);
+	}
+
+	template <std::size_t D, typename NumericT>
+	class Vector;
+
+	/// Selects the lesser or greater of two values. Vectors are compared component-wise.
+	template <typename ValueT>
+	struct Extremum
+	{
+		static ValueT lesser(const ValueT & a, const ValueT & b) {return b < a ? b : a;}
+		static ValueT greater(const ValueT & a, const ValueT & b) {return a < b ? b : a;}
+	};
+
+	template <std::size_t D, typename NumericT>
+	struct Extremum<Vector<D, NumericT>>
+	{
+		static Vector<D, NumericT> lesser(const Vector<D, NumericT> & a, const Vector<D, NumericT> & b) {return a.constrain(b, false);}
+		static Vector<D, NumericT> greater(const Vector<D, NumericT> & a, const Vector<D, NumericT> & b) {return a.constrain(b, true);}
+	};
+
+	/// The smallest of the values, using independent accumulators. For vectors, this is the lower corner of their bounding box. There must be at least one value.
+	template <typename ValueT>
+	ValueT minimum(std::size_t size, const ValueT * x)
+	{
+		assert(size > 0);
+
+		ValueT m0 = x[0], m1 = x[0];
+		std::size_t i = 1;
+
+		for (; i + 2 <= size; i += 2) {
+			m0 = Extremum<ValueT>::lesser(m0, x[i+0]);
+			m1 = Extremum<ValueT>::lesser(m1, x[i+1]);
+		}
+
+		for (; i < size; i += 1)
+			m0 = Extremum<ValueT>::lesser(m0, x[i]);
+
+		return Extremum<ValueT>::lesser(m0, m1);
+	}
+
+	/// The largest of the values. For vectors, this is the upper corner of their bounding box. There must be at least one value.
+	template <typename ValueT>
+	ValueT maximum(std::size_t size, const ValueT * x)
+	{
+		assert(size > 0);
+
+		ValueT m0 = x[0], m1 = x[0];
+		std::size_t i = 1;
+
+		for (; i + 2 <= size; i += 2) {
+			m0 = Extremum<ValueT>::greater(m0, x[i+0]);
+			m1 = Extremum<ValueT>::greater(m1, x[i+1]);
+		}
+
+		for (; i < size; i += 1)
+			m0 = Extremum<ValueT>::greater(m0, x[i]);
+
+		return Extremum<ValueT>::greater(m0, m1);
+	}
+
+	/// The inner product of each pair of vectors.
+	template <Summation SUMMATION = SERIAL, std::size_t D, typename NumericT>
+	void dot(std::size_t size, const Vector<D, NumericT> * x, const Vector<D, NumericT> * y, NumericT * result)
+	{
+		for (std::size_t i = 0; i < size; i += 1)
+			result[i] = dot<SUMMATION>(D, x[i].data(), y[i].data());
+	}
+}
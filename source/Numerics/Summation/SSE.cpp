@@ -0,0 +1,160 @@
+//
+//  SSE.cpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "SSE.hpp"
+
+#ifdef NUMERICS_SUMMATION_SSE
+
+#include "../Summation.hpp"
+
+#include <xmmintrin.h>
+
+#ifdef __FMA__
+#include <immintrin.h>
+#endif
+
+namespace Numerics
+{
+	namespace
+	{
+		inline float horizontal_sum(__m128 v)
+		{
+			float lanes[4];
+			_mm_storeu_ps(lanes, v);
+
+			return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+		}
+
+		inline void two_sum(__m128 a, __m128 b, __m128 & s, __m128 & e)
+		{
+			s = _mm_add_ps(a, b);
+
+			__m128 z = _mm_sub_ps(s, a);
+			e = _mm_add_ps(_mm_sub_ps(a, _mm_sub_ps(s, z)), _mm_sub_ps(b, z));
+		}
+
+		inline void two_product(__m128 a, __m128 b, __m128 & p, __m128 & e)
+		{
+			p = _mm_mul_ps(a, b);
+
+#ifdef __FMA__
+			e = _mm_fmsub_ps(a, b, p);
+#else
+			const __m128 FACTOR = _mm_set1_ps(4097.0f);
+
+			__m128 c = _mm_mul_ps(FACTOR, a), a_high = _mm_sub_ps(c, _mm_sub_ps(c, a)), a_low = _mm_sub_ps(a, a_high);
+			__m128 d = _mm_mul_ps(FACTOR, b), b_high = _mm_sub_ps(d, _mm_sub_ps(d, b)), b_low = _mm_sub_ps(b, b_high);
+
+			e = _mm_sub_ps(_mm_mul_ps(a_high, b_high), p);
+			e = _mm_add_ps(e, _mm_mul_ps(a_high, b_low));
+			e = _mm_add_ps(e, _mm_mul_ps(a_low, b_high));
+			e = _mm_add_ps(e, _mm_mul_ps(a_low, b_low));
+#endif
+		}
+
+		// Combine the lanes of a compensated sum, keeping the rounding error of each addition:
+		inline void horizontal_sum(__m128 s, __m128 c, float & sum, float & compensation)
+		{
+			float sums[4], compensations[4];
+			_mm_storeu_ps(sums, s);
+			_mm_storeu_ps(compensations, c);
+
+			sum = sums[0];
+			compensation = compensations[0];
+
+			for (std::size_t k = 1; k < 4; k += 1) {
+				Accumulate<COMPENSATED>::add(sum, compensation, sums[k]);
+				compensation += compensations[k];
+			}
+		}
+	}
+
+	float sum_unrolled(std::size_t size, const float * x)
+	{
+		__m128 s0 = _mm_setzero_ps(), s1 = _mm_setzero_ps();
+		std::size_t i = 0;
+
+		for (; i + 8 <= size; i += 8) {
+			s0 = _mm_add_ps(s0, _mm_loadu_ps(x + i));
+			s1 = _mm_add_ps(s1, _mm_loadu_ps(x + i + 4));
+		}
+
+		float s = horizontal_sum(_mm_add_ps(s0, s1));
+
+		for (; i < size; i += 1)
+			s += x[i];
+
+		return s;
+	}
+
+	float dot_unrolled(std::size_t size, const float * x, const float * y)
+	{
+		__m128 s0 = _mm_setzero_ps(), s1 = _mm_setzero_ps();
+		std::size_t i = 0;
+
+		for (; i + 8 <= size; i += 8) {
+			s0 = _mm_add_ps(s0, _mm_mul_ps(_mm_loadu_ps(x + i), _mm_loadu_ps(y + i)));
+			s1 = _mm_add_ps(s1, _mm_mul_ps(_mm_loadu_ps(x + i + 4), _mm_loadu_ps(y + i + 4)));
+		}
+
+		float s = horizontal_sum(_mm_add_ps(s0, s1));
+
+		for (; i < size; i += 1)
+			s += x[i] * y[i];
+
+		return s;
+	}
+
+	float sum_compensated(std::size_t size, const float * x)
+	{
+		__m128 s = _mm_setzero_ps(), c = _mm_setzero_ps();
+		std::size_t i = 0;
+
+		for (; i + 4 <= size; i += 4) {
+			__m128 e;
+			two_sum(s, _mm_loadu_ps(x + i), s, e);
+			c = _mm_add_ps(c, e);
+		}
+
+		float sum, compensation;
+		horizontal_sum(s, c, sum, compensation);
+
+		for (; i < size; i += 1)
+			Accumulate<COMPENSATED>::add(sum, compensation, x[i]);
+
+		return sum + compensation;
+	}
+
+	float dot_compensated(std::size_t size, const float * x, const float * y)
+	{
+		__m128 s = _mm_setzero_ps(), c = _mm_setzero_ps();
+		std::size_t i = 0;
+
+		for (; i + 4 <= size; i += 4) {
+			__m128 p, e, f;
+			two_product(_mm_loadu_ps(x + i), _mm_loadu_ps(y + i), p, e);
+			two_sum(s, p, s, f);
+			c = _mm_add_ps(c, _mm_add_ps(e, f));
+		}
+
+		float sum, compensation;
+		horizontal_sum(s, c, sum, compensation);
+
+		for (; i < size; i += 1) {
+			float p, e;
+			Numerics::two_product(x[i], y[i], p, e);
+
+			Accumulate<COMPENSATED>::add(sum, compensation, p);
+			compensation += e;
+		}
+
+		return sum + compensation;
+	}
+}
+
+#endif
@@ -0,0 +1,28 @@
+//
+//  SSE.hpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#ifdef __SSE2__
+
+#define NUMERICS_SUMMATION_SSE
+
+#include <cstddef>
+
+namespace Numerics
+{
+	// Sums and inner products of float arrays with eight independent accumulators, in two vectors of four lanes:
+	float sum_unrolled(std::size_t size, const float * x);
+	float dot_unrolled(std::size_t size, const float * x, const float * y);
+
+	// Compensated sums and inner products of float arrays, with each lane tracking its own rounding error. The inner product also accounts for the rounding error of each product:
+	float sum_compensated(std::size_t size, const float * x);
+	float dot_compensated(std::size_t size, const float * x, const float * y);
+}
+
+#endif
@@ -0,0 +1,203 @@
+//
+//  Trigonometry.cpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "Trigonometry.hpp"
+
+#include <limits>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+namespace Numerics
+{
+	namespace Trigonometry
+	{
+		constexpr double Minimax<float>::SINE[];
+		constexpr double Minimax<float>::COSINE[];
+		constexpr double Minimax<float>::ARCTANGENT[];
+		constexpr double Minimax<float>::ARCSINE[];
+
+		constexpr double Minimax<double>::SINE[];
+		constexpr double Minimax<double>::COSINE[];
+		constexpr double Minimax<double>::ARCTANGENT[];
+		constexpr double Minimax<double>::ARCSINE[];
+
+#ifdef __SSE2__
+		namespace
+		{
+			typedef Reduction<float> R;
+			typedef Minimax<float> P;
+
+			inline __m128 select(__m128 mask, __m128 a, __m128 b)
+			{
+				return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+			}
+
+			template <std::size_t N>
+			inline __m128 evaluate(const double (&coefficients)[N], __m128 x)
+			{
+				__m128 result = _mm_set1_ps(float(coefficients[N-1]));
+
+				for (std::size_t i = N-1; i-- > 0;)
+					result = _mm_add_ps(_mm_mul_ps(result, x), _mm_set1_ps(float(coefficients[i])));
+
+				return result;
+			}
+
+			// x + x^3 f(x^2), which is the form of the sine, arctangent and arcsine polynomials:
+			template <std::size_t N>
+			inline __m128 evaluate_odd(const double (&coefficients)[N], __m128 x)
+			{
+				__m128 z = _mm_mul_ps(x, x);
+
+				return _mm_add_ps(x, _mm_mul_ps(_mm_mul_ps(x, z), evaluate(coefficients, z)));
+			}
+
+			const __m128 SIGN = _mm_set1_ps(-0.0f);
+		}
+
+		// The same algorithm as the scalar sin_cos, with the quadrant applied using masks:
+		void sin_cos(const float * angles, float * sines, float * cosines, std::size_t count)
+		{
+			std::size_t i = 0;
+
+			for (; i + 4 <= count; i += 4) {
+				__m128 x = _mm_loadu_ps(angles + i);
+
+				// Lanes which are out of range, including NaN, are computed by the scalar fallback:
+				int fallback = _mm_movemask_ps(_mm_cmpnle_ps(_mm_andnot_ps(SIGN, x), _mm_set1_ps(R::LIMIT)));
+
+				__m128 k = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(R::INVERSE_PI_2)), _mm_set1_ps(R::ROUND)), _mm_set1_ps(R::ROUND));
+				__m128 r = _mm_sub_ps(_mm_sub_ps(_mm_sub_ps(x, _mm_mul_ps(k, _mm_set1_ps(R::PI_2_HIGH))), _mm_mul_ps(k, _mm_set1_ps(R::PI_2_MIDDLE))), _mm_mul_ps(k, _mm_set1_ps(R::PI_2_LOW)));
+				__m128 z = _mm_mul_ps(r, r);
+
+				__m128 s = evaluate_odd(P::SINE, r);
+				__m128 c = _mm_add_ps(_mm_sub_ps(_mm_set1_ps(1.0f), _mm_mul_ps(_mm_set1_ps(0.5f), z)), _mm_mul_ps(_mm_mul_ps(z, z), evaluate(P::COSINE, z)));
+
+				__m128i quadrant = _mm_cvttps_epi32(k);
+				__m128 swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(quadrant, _mm_set1_epi32(1)), _mm_set1_epi32(1)));
+
+				// The sine is negated in quadrants 2 and 3, and the cosine in quadrants 1 and 2:
+				__m128 sine_sign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(quadrant, _mm_set1_epi32(2)), 30));
+				__m128 cosine_sign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(quadrant, _mm_set1_epi32(1)), _mm_set1_epi32(2)), 30));
+
+				_mm_storeu_ps(sines + i, _mm_xor_ps(select(swap, c, s), sine_sign));
+				_mm_storeu_ps(cosines + i, _mm_xor_ps(select(swap, s, c), cosine_sign));
+
+				for (std::size_t j = 0; fallback; j += 1, fallback >>= 1) {
+					if (fallback & 1)
+						Trigonometry::sin_cos(angles[i+j], sines[i+j], cosines[i+j]);
+				}
+			}
+
+			for (; i < count; i += 1) {
+				Trigonometry::sin_cos(angles[i], sines[i], cosines[i]);
+			}
+		}
+
+		void atan2(const float * y, const float * x, float * angles, std::size_t count)
+		{
+			std::size_t i = 0;
+
+			for (; i + 4 <= count; i += 4) {
+				__m128 yi = _mm_loadu_ps(y + i), xi = _mm_loadu_ps(x + i);
+				__m128 ay = _mm_andnot_ps(SIGN, yi), ax = _mm_andnot_ps(SIGN, xi);
+
+				const __m128 maximum_finite = _mm_set1_ps(std::numeric_limits<float>::max());
+				int fallback = _mm_movemask_ps(_mm_or_ps(_mm_cmpnle_ps(ax, maximum_finite), _mm_cmpnle_ps(ay, maximum_finite)));
+
+				__m128 maximum = _mm_max_ps(ax, ay), minimum = _mm_min_ps(ax, ay);
+
+				// When both are zero the quotient is NaN, which is masked to zero:
+				__m128 t = _mm_and_ps(_mm_div_ps(minimum, maximum), _mm_cmpgt_ps(maximum, _mm_setzero_ps()));
+
+				__m128 reduce = _mm_cmpgt_ps(t, _mm_set1_ps(0.414213562373095049f));
+				__m128 one = _mm_set1_ps(1.0f);
+				t = select(reduce, _mm_div_ps(_mm_sub_ps(t, one), _mm_add_ps(t, one)), t);
+
+				__m128 a = _mm_add_ps(_mm_and_ps(reduce, _mm_set1_ps(R::PI_4)), evaluate_odd(P::ARCTANGENT, t));
+
+				a = select(_mm_cmpgt_ps(ay, ax), _mm_sub_ps(_mm_set1_ps(R::PI_2), a), a);
+				a = select(_mm_castsi128_ps(_mm_srai_epi32(_mm_castps_si128(xi), 31)), _mm_sub_ps(_mm_set1_ps(R::PI), a), a);
+
+				_mm_storeu_ps(angles + i, _mm_or_ps(_mm_andnot_ps(SIGN, a), _mm_and_ps(SIGN, yi)));
+
+				for (std::size_t j = 0; fallback; j += 1, fallback >>= 1) {
+					if (fallback & 1)
+						angles[i+j] = Trigonometry::atan2(y[i+j], x[i+j]);
+				}
+			}
+
+			for (; i < count; i += 1) {
+				angles[i] = Trigonometry::atan2(y[i], x[i]);
+			}
+		}
+
+		void acos(const float * values, float * angles, std::size_t count)
+		{
+			std::size_t i = 0;
+
+			for (; i + 4 <= count; i += 4) {
+				__m128 x = _mm_loadu_ps(values + i);
+				__m128 ax = _mm_andnot_ps(SIGN, x);
+				__m128 small = _mm_cmple_ps(ax, _mm_set1_ps(0.5f));
+
+				// Both halves of the domain share one evaluation of the polynomial:
+				__m128 u = select(small, x, _mm_sqrt_ps(_mm_mul_ps(_mm_sub_ps(_mm_set1_ps(1.0f), ax), _mm_set1_ps(0.5f))));
+				__m128 a = evaluate_odd(P::ARCSINE, u);
+
+				__m128 large = _mm_add_ps(a, a);
+				large = select(_mm_cmplt_ps(x, _mm_setzero_ps()), _mm_sub_ps(_mm_set1_ps(R::PI), large), large);
+
+				_mm_storeu_ps(angles + i, select(small, _mm_sub_ps(_mm_set1_ps(R::PI_2), a), large));
+			}
+
+			for (; i < count; i += 1) {
+				angles[i] = Trigonometry::acos(values[i]);
+			}
+		}
+#else
+		void sin_cos(const float * angles, float * sines, float * cosines, std::size_t count)
+		{
+			for (std::size_t i = 0; i < count; i += 1)
+				Trigonometry::sin_cos(angles[i], sines[i], cosines[i]);
+		}
+
+		void atan2(const float * y, const float * x, float * angles, std::size_t count)
+		{
+			for (std::size_t i = 0; i < count; i += 1)
+				angles[i] = Trigonometry::atan2(y[i], x[i]);
+		}
+
+		void acos(const float * values, float * angles, std::size_t count)
+		{
+			for (std::size_t i = 0; i < count; i += 1)
+				angles[i] = Trigonometry::acos(values[i]);
+		}
+#endif
+
+		void sin_cos(const double * angles, double * sines, double * cosines, std::size_t count)
+		{
+			for (std::size_t i = 0; i < count; i += 1)
+				Trigonometry::sin_cos(angles[i], sines[i], cosines[i]);
+		}
+
+		void atan2(const double * y, const double * x, double * angles, std::size_t count)
+		{
+			for (std::size_t i = 0; i < count; i += 1)
+				angles[i] = Trigonometry::atan2(y[i], x[i]);
+		}
+
+		void acos(const double * values, double * angles, std::size_t count)
+		{
+			for (std::size_t i = 0; i < count; i += 1)
+				angles[i] = Trigonometry::acos(values[i]);
+		}
+	}
+}
@@ -0,0 +1,311 @@
+//
+//  Trigonometry.hpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "Float.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <algorithm>
+#include <type_traits>
+
+namespace Numerics
+{
+	namespace Trigonometry
+	{
+		/// Minimax polynomial coefficients in the square of the reduced argument, from the lowest power. The float tier has a relative error around 1e-8, and the double tier around 1e-17.
+		template <typename TierT>
+		struct Minimax;
+
+		template <>
+		struct Minimax<float>
+		{
+			/// sin(r) = r + r^3 SINE(r^2) for |r| <= pi/4.
+			static constexpr double SINE[] = {-1.66666549436959494e-01, 8.33217814584400265e-03, -1.95172989438928245e-04};
+
+			/// cos(r) = 1 - r^2/2 + r^4 COSINE(r^2) for |r| <= pi/4.
+			static constexpr double COSINE[] = {4.16666468664580181e-02, -1.38873675164596531e-03, 2.44384516688936743e-05};
+
+			/// atan(t) = t + t^3 ARCTANGENT(t^2) for |t| <= sqrt(2) - 1.
+			static constexpr double ARCTANGENT[] = {-3.33329552531828277e-01, 1.99779260699701755e-01, -1.38798498875529197e-01, 8.06030865145520442e-02};
+
+			/// asin(x) = x + x^3 ARCSINE(x^2) for |x| <= 1/2.
+			static constexpr double ARCSINE[] = {1.66667539280516419e-01, 7.49524176403213449e-02, 4.54770997201207061e-02, 2.41475966168628875e-02, 4.22185742723683449e-02};
+		};
+
+		template <>
+		struct Minimax<double>
+		{
+			static constexpr double SINE[] = {
+				-1.66666666666666324e-01, 8.33333333332242528e-03, -1.98412698298169638e-04,
+				2.75573136952307324e-06, -2.50507586538605748e-08, 1.58968279597608695e-10
+			};
+
+			static constexpr double COSINE[] = {
+				4.16666666666666019e-02, -1.38888888888741378e-03, 2.48015872894918337e-05,
+				-2.75573143552434191e-07, 2.08757236846003793e-09, -1.13596698749031933e-11
+			};
+
+			static constexpr double ARCTANGENT[] = {
+				-3.33333333333331983e-01, 1.99999999999540823e-01, -1.42857142802485265e-01, 1.11111107861383049e-01,
+				-9.09089783645568861e-02, 7.69206163714684643e-02, -6.66312038349104185e-02, 5.84800890929334377e-02,
+				-5.03984546740007464e-02, 3.80783196306498026e-02, -1.79222777040885101e-02
+			};
+
+			static constexpr double ARCSINE[] = {
+				1.66666666666667629e-01, 7.49999999997026101e-02, 4.46428571751213074e-02, 3.03819426835988393e-02,
+				2.23722156606871413e-02, 1.73516000868151402e-02, 1.39809614944824915e-02, 1.13977757382343163e-02,
+				1.07865300417828540e-02, 3.68303932857748590e-03, 2.17635037330399066e-02, -2.10772967479498641e-02,
+				3.26768916201596107e-02
+			};
+		};
+
+		/// The tier of polynomials used to evaluate arguments of type FloatT with the given precision.
+		template <Precision PRECISION, typename FloatT>
+		struct TierTraits
+		{
+			typedef FloatT TierT;
+		};
+
+		template <typename FloatT>
+		struct TierTraits<FAST, FloatT>
+		{
+			typedef float TierT;
+		};
+
+		/// Constants for reducing arguments of type FloatT. Pi/2 is split into three parts (Cody & Waite) so that k * PI_2_HIGH and k * PI_2_MIDDLE are exact for |k| up to around LIMIT. Larger arguments fall back to the standard library.
+		template <typename FloatT>
+		struct Reduction;
+
+		template <>
+		struct Reduction<float>
+		{
+			static constexpr float PI_2_HIGH = 1.5703125f, PI_2_MIDDLE = 4.837512969970703125e-4f, PI_2_LOW = 7.54978995489188216e-8f;
+			static constexpr float INVERSE_PI_2 = 0.636619772367581343f, PI = 3.14159265358979323846f, PI_2 = 1.57079632679489661923f, PI_4 = 0.785398163397448309616f;
+
+			/// Adding and subtracting this rounds a float to the nearest integer.
+			static constexpr float ROUND = 12582912.0f;
+
+			static constexpr float LIMIT = 8192.0f;
+		};
+
+		template <>
+		struct Reduction<double>
+		{
+			static constexpr double PI_2_HIGH = 1.57079632673412561417e+00, PI_2_MIDDLE = 6.07710050630396597660e-11, PI_2_LOW = 2.02226624879595063154e-21;
+			static constexpr double INVERSE_PI_2 = 0.636619772367581343076, PI = 3.14159265358979323846, PI_2 = 1.57079632679489661923, PI_4 = 0.785398163397448309616;
+
+			static constexpr double ROUND = 6755399441055744.0;
+
+			static constexpr double LIMIT = 1048576.0;
+		};
+
+		/// Whether arguments of type NumericT are evaluated using polynomial approximations.
+		template <typename NumericT>
+		struct Approximated : std::integral_constant<bool, std::is_same<NumericT, float>::value || std::is_same<NumericT, double>::value> {};
+
+		/// Evaluate a polynomial at x using Horner's method.
+		template <typename FloatT, std::size_t N>
+		inline FloatT evaluate(const double (&coefficients)[N], FloatT x)
+		{
+			FloatT result = FloatT(coefficients[N-1]);
+
+			for (std::size_t i = N-1; i-- > 0;)
+				result = result * x + FloatT(coefficients[i]);
+
+			return result;
+		}
+
+		/// Compute sin(x) and cos(x) together, sharing the argument reduction. Accurate to a few units in the last place for EXACT precision.
+		template <Precision PRECISION = EXACT, typename FloatT>
+		inline typename std::enable_if<Approximated<FloatT>::value>::type
+		sin_cos(FloatT x, FloatT & sine, FloatT & cosine)
+		{
+			typedef Reduction<FloatT> R;
+			typedef Minimax<typename TierTraits<PRECISION, FloatT>::TierT> P;
+
+			// This also handles infinity and NaN:
+			if (!(std::abs(x) <= R::LIMIT)) {
+				sine = std::sin(x);
+				cosine = std::cos(x);
+				return;
+			}
+
+			FloatT k = (x * R::INVERSE_PI_2 + R::ROUND) - R::ROUND;
+			FloatT r = ((x - k * R::PI_2_HIGH) - k * R::PI_2_MIDDLE) - k * R::PI_2_LOW;
+			FloatT z = r * r;
+
+			FloatT s = r + r * z * evaluate(P::SINE, z);
+			FloatT c = (FloatT(1) - FloatT(0.5) * z) + z * z * evaluate(P::COSINE, z);
+
+			// The quadrant of x, which is also correct for negative k in two's complement:
+			switch (static_cast<int>(k) & 3) {
+				case 0: sine = s; cosine = c; break;
+				case 1: sine = c; cosine = -s; break;
+				case 2: sine = -s; cosine = -c; break;
+				default: sine = -c; cosine = s; break;
+			}
+		}
+
+		/// Fall back to the standard library for other numeric types, e.g. fixed point.
+		template <Precision PRECISION = EXACT, typename NumericT>
+		inline typename std::enable_if<!Approximated<NumericT>::value>::type
+		sin_cos(const NumericT & x, NumericT & sine, NumericT & cosine)
+		{
+			using std::sin;
+			using std::cos;
+
+			sine = sin(x);
+			cosine = cos(x);
+		}
+
+		template <Precision PRECISION = EXACT, typename FloatT>
+		inline FloatT sin(FloatT x)
+		{
+			FloatT sine, cosine;
+			sin_cos<PRECISION>(x, sine, cosine);
+
+			return sine;
+		}
+
+		template <Precision PRECISION = EXACT, typename FloatT>
+		inline FloatT cos(FloatT x)
+		{
+			FloatT sine, cosine;
+			sin_cos<PRECISION>(x, sine, cosine);
+
+			return cosine;
+		}
+
+		template <Precision PRECISION = EXACT, typename FloatT>
+		inline FloatT tan(FloatT x)
+		{
+			FloatT sine, cosine;
+			sin_cos<PRECISION>(x, sine, cosine);
+
+			return sine / cosine;
+		}
+
+		/// Wrap an angle to (-pi, pi]. Exact for |x| up to around the reduction limit, and then only as accurate as the argument.
+		template <typename FloatT>
+		inline FloatT wrap(FloatT x)
+		{
+			typedef Reduction<FloatT> R;
+
+			if (!(std::abs(x) <= R::LIMIT))
+				return std::remainder(x, 2 * R::PI);
+
+			// Multiples of 2pi are multiples of pi/2, so the same split constants can be used:
+			FloatT k = ((x * (R::INVERSE_PI_2 / 4) + R::ROUND) - R::ROUND) * 4;
+			FloatT r = ((x - k * R::PI_2_HIGH) - k * R::PI_2_MIDDLE) - k * R::PI_2_LOW;
+
+			if (r <= -R::PI) r += 2 * R::PI;
+			else if (r > R::PI) r -= 2 * R::PI;
+
+			return r;
+		}
+
+		/// The angle of the vector (x, y) from the x axis, in [-pi, pi].
+		template <Precision PRECISION = EXACT, typename FloatT>
+		inline FloatT atan2(FloatT y, FloatT x)
+		{
+			typedef Reduction<FloatT> R;
+			typedef Minimax<typename TierTraits<PRECISION, FloatT>::TierT> P;
+
+			if (!(std::isfinite(x) && std::isfinite(y)))
+				return std::atan2(y, x);
+
+			FloatT ax = std::abs(x), ay = std::abs(y);
+			FloatT maximum = std::max(ax, ay), minimum = std::min(ax, ay);
+
+			FloatT t = maximum > 0 ? minimum / maximum : 0, offset = 0;
+
+			// atan(t) = pi/4 + atan((t - 1) / (t + 1)), which reduces t to the range of the polynomial:
+			if (t > FloatT(0.414213562373095049)) {
+				t = (t - 1) / (t + 1);
+				offset = R::PI_4;
+			}
+
+			FloatT z = t * t;
+			FloatT a = offset + (t + t * z * evaluate(P::ARCTANGENT, z));
+
+			if (ay > ax) a = R::PI_2 - a;
+			if (std::signbit(x)) a = R::PI - a;
+
+			return std::copysign(a, y);
+		}
+
+		template <Precision PRECISION = EXACT, typename FloatT>
+		inline FloatT atan(FloatT x)
+		{
+			return atan2<PRECISION>(x, FloatT(1));
+		}
+
+		/// asin(x) for |x| <= 1/2.
+		template <Precision PRECISION, typename FloatT>
+		inline FloatT asin_reduced(FloatT x)
+		{
+			typedef Minimax<typename TierTraits<PRECISION, FloatT>::TierT> P;
+
+			FloatT z = x * x;
+
+			return x + x * z * evaluate(P::ARCSINE, z);
+		}
+
+		template <Precision PRECISION = EXACT, typename FloatT>
+		inline FloatT asin(FloatT x)
+		{
+			typedef Reduction<FloatT> R;
+
+			FloatT ax = std::abs(x);
+
+			if (ax <= FloatT(0.5))
+				return asin_reduced<PRECISION>(x);
+
+			// asin(x) = pi/2 - 2 asin(sqrt((1 - x) / 2)), which is NaN for |x| > 1:
+			FloatT a = R::PI_2 - 2 * asin_reduced<PRECISION>(std::sqrt((1 - ax) / 2));
+
+			return std::copysign(a, x);
+		}
+
+		template <Precision PRECISION = EXACT, typename FloatT>
+		inline typename std::enable_if<Approximated<FloatT>::value, FloatT>::type
+		acos(FloatT x)
+		{
+			typedef Reduction<FloatT> R;
+
+			if (std::abs(x) <= FloatT(0.5))
+				return R::PI_2 - asin_reduced<PRECISION>(x);
+
+			// acos(x) = 2 asin(sqrt((1 - x) / 2)), and acos(-x) = pi - acos(x):
+			FloatT a = 2 * asin_reduced<PRECISION>(std::sqrt((1 - std::abs(x)) / 2));
+
+			return x < 0 ? R::PI - a : a;
+		}
+
+		template <Precision PRECISION = EXACT, typename NumericT>
+		inline typename std::enable_if<!Approximated<NumericT>::value, NumericT>::type
+		acos(const NumericT & x)
+		{
+			using std::acos;
+
+			return acos(x);
+		}
+
+		/// Element-wise functions on arrays, which use SIMD for float where available. Double precision arrays are evaluated one element at a time.
+		void sin_cos(const float * angles, float * sines, float * cosines, std::size_t count);
+		void sin_cos(const double * angles, double * sines, double * cosines, std::size_t count);
+
+		void atan2(const float * y, const float * x, float * angles, std::size_t count);
+		void atan2(const double * y, const double * x, double * angles, std::size_t count);
+
+		void acos(const float * values, float * angles, std::size_t count);
+		void acos(const double * values, double * angles, std::size_t count);
+	}
+}
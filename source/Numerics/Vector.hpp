@@ -11,6 +11,7 @@
 #include "Number.hpp"
 #include "Float.hpp"
 #include "Interpolate.hpp"
+#include "Summation.hpp"
 
 #include <type_traits>
 #include <array>
@@ -183,9 +184,11 @@ namespace Numerics
 			return result;
 		}
 		
+		/// The sum of the components. The default SERIAL summation adds them in order, which is best for small vectors.
+		template <Summation SUMMATION = SERIAL>
 		Number<NumericT> sum() const
 		{
-			return reduce(static_cast<NumericT>(0), [](NumericT a, NumericT b){return a+b;});
+			return Numerics::sum<SUMMATION>(D, this->data());
 		}
 		
 		Number<NumericT> product() const
@@ -193,10 +196,10 @@ namespace Numerics
 			return reduce(static_cast<NumericT>(1), [](NumericT a, NumericT b){return a*b;});
 		}
 		
-		template <typename OtherT>
+		template <Summation SUMMATION = SERIAL, typename OtherT>
 		Number<NumericT> dot(const OtherT & other) const
 		{
-			return ((*this) * other).sum();
+			return ((*this) * other).template sum<SUMMATION>();
 		}
 		
 		/// Return the length of the vector squared.
@@ -206,10 +209,17 @@ namespace Numerics
 			return dot(*this);
 		}
 
-		/// Return the length of the vector.
-		auto length() const
+		/// Return the length of the vector. The FAST precision multiplies by the reciprocal square root rather than computing the square root.
+		template <Precision PRECISION = EXACT>
+		Number<typename RealTypeTraits<NumericT>::RealT> length() const
 		{
-			return length_squared().square_root();
+			auto squared = length_squared();
+
+			// The reciprocal square root of zero is infinite:
+			if (PRECISION == FAST && squared.value != 0)
+				return squared.value * squared.template reciprocal_square_root<FAST>();
+
+			return squared.square_root();
 		}
 		
 		/// Normalize the vector to the given length. Defaults to 1.
@@ -224,20 +234,37 @@ namespace Numerics
 			return *this;
 		}
 
-		/// Normalize the vector to the given length. Defaults to 1.
+		/// Normalize the vector to the given length. Defaults to 1. The FAST precision scales by the reciprocal square root of the squared length, which is accurate to a few units in the last place of float.
+		template <Precision PRECISION = EXACT>
 		Vector normalize(const NumericT & desired_length = 1) const
 		{
+			if (PRECISION == FAST) {
+				auto squared = length_squared();
+
+				// Can't normalize zero length vector.
+				if (squared.value == 0) return *this;
+
+				return (*this) * NumericT(desired_length * squared.template reciprocal_square_root<FAST>());
+			}
+
 			auto current_length = length();
 			
 			// Can't normalize zero length vector.
 			if (current_length.equivalent(0)) return *this;
 			
-			return Vector(*this).normalize(current_length, desired_length);
+			return Vector(*this).normalize(NumericT(current_length), desired_length);
 		}
 		
-		/// Calculates the angle between this vector and another.
+		/// Calculates the angle between this vector and another. The FAST precision takes a single reciprocal square root of the product of the squared lengths, which overflows for very large or small vectors, and approximates the arc cosine.
+		template <Precision PRECISION = EXACT>
 		Radians<NumericT> angle_between(const Vector & other) const
 		{
+			if (PRECISION == FAST) {
+				auto r = dot(other) * number(length_squared() * other.length_squared()).template reciprocal_square_root<FAST>();
+
+				return number(r).clamp(-1, 1).template acos<FAST>();
+			}
+
 			auto r = dot(other) / (length() * other.length());
 
 			return number(r).clamp(-1, 1).acos();
@@ -252,6 +279,7 @@ namespace Numerics
 		
 		/// Distribute an index into a given space.
 		/// For example, when considering a size vector <tt><10, 15></tt>, we have defined a space which is 10 units wide and 15 units high. Therefore, an index in the range 0 to 9 will be in the first row, and 10 to 19 will be in the second row.
+		/// This divides once per dimension, so to visit every coordinate in order use Range or GridView, which advance incrementally.
 		/// @sa index
 		Vector distribute(NumericT k) const
 		{
@@ -384,8 +412,8 @@ namespace Numerics
 			return *this;
 		}
 		
-		template <typename FunctionT>
-		Vector & fold(const Number<NumericT> & other, FunctionT function)
+		template <typename OtherNumericT, typename FunctionT>
+		Vector & fold(const Number<OtherNumericT> & other, FunctionT function)
 		{
 			return fold(other.value, function);
 		}
@@ -474,13 +502,13 @@ namespace Numerics
 	}
 
 	/// Calculates the surface normal of a triangle given by three points.
-	template <typename NumericT>
+	template <Precision PRECISION = EXACT, typename NumericT>
 	Vector<3, NumericT> surface_normal(const Vector<3, NumericT> & a, const Vector<3, NumericT> & b, const Vector<3, NumericT> & c)
 	{
 		Vector<3, NumericT> a1 = b - a;
 		Vector<3, NumericT> b1 = c - b;
 
-		return cross_product(a1, b1).normalize();
+		return cross_product(a1, b1).template normalize<PRECISION>();
 	}
 
 	// Calculate a clockwise normal to the 2d vector.
@@ -0,0 +1,229 @@
+//
+//  Compress.hpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "../Vector.hpp"
+#include "../Integer.hpp"
+
+#include "SSE.hpp"
+
+#include <cstdint>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+namespace Numerics
+{
+	/**
+	 * Compresses unit vectors using the octahedral encoding. The vector is projected onto the octahedron |x| + |y| + |z| = 1, the lower half of which is folded over the upper half to give a square, and the two coordinates in that square are quantized to BITS each.
+	 *
+	 * Each coordinate is within e = 1/(2^BITS - 1) of its true value, so the point on the octahedron moves by at most sqrt(3) * sqrt(2) e. As every point on the octahedron is at least 1/sqrt(3) from the origin, the angle between a unit vector and its decoded value is at most asin(3 sqrt(2) / (2^BITS - 1)). This is 0.017 radians (0.95 degrees) for 8 bits, 0.0010 radians for 12 bits and 0.000065 radians for 16 bits.
+	 */
+	template <std::size_t BITS, typename StorageT>
+	struct Octahedral
+	{
+		static_assert(BITS * 2 <= sizeof(StorageT) * 8, "Storage is too small for the number of bits!");
+
+		enum : std::uint64_t {
+			MAXIMUM = (std::uint64_t(1) << BITS) - 1
+		};
+
+		/// The maximum angle in radians between a unit vector and its decoded value.
+		static float maximum_angular_error()
+		{
+			return std::asin(3 * float(M_SQRT2) / MAXIMUM);
+		}
+
+		static StorageT encode(const Vector<3, float> & normal)
+		{
+			float scale = 1 / (std::abs(normal[X]) + std::abs(normal[Y]) + std::abs(normal[Z]));
+			float u = normal[X] * scale, v = normal[Y] * scale;
+
+			// Fold the lower half over the upper half:
+			if (normal[Z] < 0) {
+				float folded_u = (1 - std::abs(v)) * (u >= 0 ? 1 : -1);
+				float folded_v = (1 - std::abs(u)) * (v >= 0 ? 1 : -1);
+
+				u = folded_u;
+				v = folded_v;
+			}
+
+			return StorageT((quantize(u) << BITS) | quantize(v));
+		}
+
+		static Vector<3, float> decode(const StorageT & encoded)
+		{
+			const std::uint64_t value = encoded;
+
+			float u = float(value >> BITS) * (2.0f / MAXIMUM) - 1;
+			float v = float(value & MAXIMUM) * (2.0f / MAXIMUM) - 1;
+			float z = 1 - std::abs(u) - std::abs(v);
+
+			// Unfold the lower half, which is where z is negative:
+			float t = std::max(-z, 0.0f);
+			u += u >= 0 ? -t : t;
+			v += v >= 0 ? -t : t;
+
+			float scale = 1 / std::sqrt(u * u + v * v + z * z);
+
+			return {u * scale, v * scale, z * scale};
+		}
+
+		static void encode(StorageT * result, const Vector<3, float> * source, std::size_t count)
+		{
+			for (std::size_t i = 0; i < count; i += 1)
+				result[i] = encode(source[i]);
+		}
+
+		static void decode(Vector<3, float> * result, const StorageT * source, std::size_t count)
+		{
+			for (std::size_t i = 0; i < count; i += 1)
+				result[i] = decode(source[i]);
+		}
+
+	private:
+		// Map [-1, 1] to [0, MAXIMUM]:
+		static std::uint64_t quantize(float value)
+		{
+			return std::uint64_t(std::lrint(std::min(std::max((value + 1) * (MAXIMUM * 0.5f), 0.0f), float(MAXIMUM))));
+		}
+	};
+
+	/// Two 8-bit coordinates.
+	typedef Octahedral<8, std::uint16_t> Octahedral16;
+
+	/// Two 12-bit coordinates.
+	typedef Octahedral<12, UInt24> Octahedral24;
+
+	/// Two 16-bit coordinates.
+	typedef Octahedral<16, std::uint32_t> Octahedral32;
+
+#ifdef NUMERICS_VECTOR_SSE
+	// These are optimised specializations for SSE2, which process four vectors at a time:
+	template <> void Octahedral<8, std::uint16_t>::encode(std::uint16_t * result, const Vector<3, float> * source, std::size_t count);
+	template <> void Octahedral<8, std::uint16_t>::decode(Vector<3, float> * result, const std::uint16_t * source, std::size_t count);
+	template <> void Octahedral<12, UInt24>::encode(UInt24 * result, const Vector<3, float> * source, std::size_t count);
+	template <> void Octahedral<12, UInt24>::decode(Vector<3, float> * result, const UInt24 * source, std::size_t count);
+	template <> void Octahedral<16, std::uint32_t>::encode(std::uint32_t * result, const Vector<3, float> * source, std::size_t count);
+	template <> void Octahedral<16, std::uint32_t>::decode(Vector<3, float> * result, const std::uint32_t * source, std::size_t count);
+#endif
+
+	/// Encodes arrays of values for Quantization, one value at a time. This is specialized where SIMD is available.
+	template <std::size_t D, typename IntegerT, typename NumericT>
+	struct QuantizeArray
+	{
+		template <typename QuantizationT>
+		static void encode(const QuantizationT & quantization, Vector<D, IntegerT> * result, const Vector<D, NumericT> * source, std::size_t count)
+		{
+			for (std::size_t i = 0; i < count; i += 1)
+				result[i] = quantization.encode(source[i]);
+		}
+	};
+
+#ifdef NUMERICS_VECTOR_SSE
+	// Quantize arrays of Vector<3, float> four at a time, with the same results as Quantization::encode:
+	void quantize_3(std::uint8_t * result, const float * source, std::size_t count, const float * minimum, const float * inverse_step, float maximum);
+	void quantize_3(std::uint16_t * result, const float * source, std::size_t count, const float * minimum, const float * inverse_step, float maximum);
+	void quantize_3(std::uint32_t * result, const float * source, std::size_t count, const float * minimum, const float * inverse_step, float maximum);
+
+	template <typename IntegerT>
+	struct QuantizeArray<3, IntegerT, float>
+	{
+		template <typename QuantizationT>
+		static void encode(const QuantizationT & quantization, Vector<3, IntegerT> * result, const Vector<3, float> * source, std::size_t count)
+		{
+			static_assert(sizeof(Vector<3, IntegerT>) == sizeof(IntegerT) * 3, "Vectors must be packed!");
+			static_assert(sizeof(Vector<3, float>) == sizeof(float) * 3, "Vectors must be packed!");
+
+			quantize_3(reinterpret_cast<IntegerT *>(result), reinterpret_cast<const float *>(source), count, quantization.minimum().data(), quantization.inverse_step().data(), float(QuantizationT::MAXIMUM));
+		}
+	};
+#endif
+
+	/// Quantizes each component of vectors within a bounding box to a fixed number of bits, e.g. positions or colours.
+	template <std::size_t D, std::size_t BITS, typename NumericT = RealT>
+	class Quantization
+	{
+	public:
+		static_assert(BITS <= 32, "Quantization supports up to 32 bits per component!");
+		static_assert(BITS < std::numeric_limits<NumericT>::digits, "Quantization needs one more bit of significand than BITS to round correctly!");
+
+		enum : std::uint64_t {
+			MAXIMUM = (std::uint64_t(1) << BITS) - 1
+		};
+
+		/// The smallest unsigned integer type which can hold BITS.
+		typedef typename IntegerSizeTraits<(BITS <= 8) ? 1 : (BITS <= 16) ? 2 : 4>::UnsignedT IntegerT;
+		typedef Vector<D, IntegerT> CodeT;
+
+		Quantization(const Vector<D, NumericT> & minimum, const Vector<D, NumericT> & maximum) : _minimum(minimum)
+		{
+			for (std::size_t i = 0; i < D; i += 1) {
+				_step[i] = (maximum[i] - minimum[i]) / NumericT(MAXIMUM);
+				_inverse_step[i] = NumericT(MAXIMUM) / (maximum[i] - minimum[i]);
+
+				// Half of the quantization step, with an allowance for the rounding error of decoding:
+				_maximum_error[i] = _step[i] / 2 + std::max(std::abs(minimum[i]), std::abs(maximum[i])) * std::numeric_limits<NumericT>::epsilon() * 4;
+			}
+		}
+
+		const Vector<D, NumericT> & minimum() const {return _minimum;}
+
+		/// The number of quantization steps per unit in each dimension.
+		const Vector<D, NumericT> & inverse_step() const {return _inverse_step;}
+
+		/// The maximum difference between each component of a value within the bounds and its decoded value.
+		const Vector<D, NumericT> & maximum_error() const {return _maximum_error;}
+
+		/// Whether a decoded value is equivalent to the original value, i.e. within the maximum error.
+		bool equivalent(const Vector<D, NumericT> & decoded, const Vector<D, NumericT> & value) const
+		{
+			for (std::size_t i = 0; i < D; i += 1)
+				if (std::abs(decoded[i] - value[i]) > _maximum_error[i]) return false;
+
+			return true;
+		}
+
+		/// Values outside the bounds are clamped.
+		CodeT encode(const Vector<D, NumericT> & value) const
+		{
+			CodeT code;
+
+			// The values are non-negative, so adding 0.5 and truncating rounds to nearest, which vectorises better than std::lrint:
+			for (std::size_t i = 0; i < D; i += 1)
+				code[i] = IntegerT(std::min(std::max((value[i] - _minimum[i]) * _inverse_step[i], NumericT(0)), NumericT(MAXIMUM)) + NumericT(0.5));
+
+			return code;
+		}
+
+		Vector<D, NumericT> decode(const CodeT & code) const
+		{
+			Vector<D, NumericT> value;
+
+			for (std::size_t i = 0; i < D; i += 1)
+				value[i] = _minimum[i] + NumericT(code[i]) * _step[i];
+
+			return value;
+		}
+
+		void encode(CodeT * result, const Vector<D, NumericT> * source, std::size_t count) const
+		{
+			QuantizeArray<D, IntegerT, NumericT>::encode(*this, result, source, count);
+		}
+
+		void decode(Vector<D, NumericT> * result, const CodeT * source, std::size_t count) const
+		{
+			for (std::size_t i = 0; i < count; i += 1)
+				result[i] = decode(source[i]);
+		}
+
+	private:
+		Vector<D, NumericT> _minimum, _step, _inverse_step, _maximum_error;
+	};
+}
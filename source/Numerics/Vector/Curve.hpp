@@ -0,0 +1,386 @@
+//
+//  Curve.hpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#include "../Vector.hpp"
+#include "Compress.hpp"
+
+#include "SSE.hpp"
+
+#include <cstdint>
+#include <limits>
+
+#ifdef __BMI2__
+#include <immintrin.h>
+#endif
+
+namespace Numerics
+{
+	/// Spreads the bits of a coordinate so that they are D bits apart, and compacts them again, using a sequence of shifts and masks. Each coordinate has BITS bits, so that D coordinates fit in CodeT.
+	template <std::size_t D, typename CodeT>
+	struct MagicBits;
+
+	template <>
+	struct MagicBits<2, std::uint32_t>
+	{
+		enum : std::uint32_t {
+			BITS = 16,
+			MASK = 0x55555555
+		};
+
+		static std::uint32_t spread(std::uint32_t x)
+		{
+			x &= 0x0000FFFF;
+			x = (x | (x << 8)) & 0x00FF00FF;
+			x = (x | (x << 4)) & 0x0F0F0F0F;
+			x = (x | (x << 2)) & 0x33333333;
+			x = (x | (x << 1)) & 0x55555555;
+
+			return x;
+		}
+
+		static std::uint32_t compact(std::uint32_t x)
+		{
+			x &= 0x55555555;
+			x = (x | (x >> 1)) & 0x33333333;
+			x = (x | (x >> 2)) & 0x0F0F0F0F;
+			x = (x | (x >> 4)) & 0x00FF00FF;
+			x = (x | (x >> 8)) & 0x0000FFFF;
+
+			return x;
+		}
+	};
+
+	template <>
+	struct MagicBits<2, std::uint64_t>
+	{
+		enum : std::uint64_t {
+			BITS = 32,
+			MASK = 0x5555555555555555
+		};
+
+		static std::uint64_t spread(std::uint64_t x)
+		{
+			x &= 0x00000000FFFFFFFF;
+			x = (x | (x << 16)) & 0x0000FFFF0000FFFF;
+			x = (x | (x << 8)) & 0x00FF00FF00FF00FF;
+			x = (x | (x << 4)) & 0x0F0F0F0F0F0F0F0F;
+			x = (x | (x << 2)) & 0x3333333333333333;
+			x = (x | (x << 1)) & 0x5555555555555555;
+
+			return x;
+		}
+
+		static std::uint64_t compact(std::uint64_t x)
+		{
+			x &= 0x5555555555555555;
+			x = (x | (x >> 1)) & 0x3333333333333333;
+			x = (x | (x >> 2)) & 0x0F0F0F0F0F0F0F0F;
+			x = (x | (x >> 4)) & 0x00FF00FF00FF00FF;
+			x = (x | (x >> 8)) & 0x0000FFFF0000FFFF;
+			x = (x | (x >> 16)) & 0x00000000FFFFFFFF;
+
+			return x;
+		}
+	};
+
+	template <>
+	struct MagicBits<3, std::uint32_t>
+	{
+		enum : std::uint32_t {
+			BITS = 10,
+			MASK = 0x09249249
+		};
+
+		static std::uint32_t spread(std::uint32_t x)
+		{
+			x &= 0x000003FF;
+			x = (x | (x << 16)) & 0x030000FF;
+			x = (x | (x << 8)) & 0x0300F00F;
+			x = (x | (x << 4)) & 0x030C30C3;
+			x = (x | (x << 2)) & 0x09249249;
+
+			return x;
+		}
+
+		static std::uint32_t compact(std::uint32_t x)
+		{
+			x &= 0x09249249;
+			x = (x | (x >> 2)) & 0x030C30C3;
+			x = (x | (x >> 4)) & 0x0300F00F;
+			x = (x | (x >> 8)) & 0x030000FF;
+			x = (x | (x >> 16)) & 0x000003FF;
+
+			return x;
+		}
+	};
+
+	template <>
+	struct MagicBits<3, std::uint64_t>
+	{
+		enum : std::uint64_t {
+			BITS = 21,
+			MASK = 0x1249249249249249
+		};
+
+		static std::uint64_t spread(std::uint64_t x)
+		{
+			x &= 0x00000000001FFFFF;
+			x = (x | (x << 32)) & 0x001F00000000FFFF;
+			x = (x | (x << 16)) & 0x001F0000FF0000FF;
+			x = (x | (x << 8)) & 0x100F00F00F00F00F;
+			x = (x | (x << 4)) & 0x10C30C30C30C30C3;
+			x = (x | (x << 2)) & 0x1249249249249249;
+
+			return x;
+		}
+
+		static std::uint64_t compact(std::uint64_t x)
+		{
+			x &= 0x1249249249249249;
+			x = (x | (x >> 2)) & 0x10C30C30C30C30C3;
+			x = (x | (x >> 4)) & 0x100F00F00F00F00F;
+			x = (x | (x >> 8)) & 0x001F0000FF0000FF;
+			x = (x | (x >> 16)) & 0x001F00000000FFFF;
+			x = (x | (x >> 32)) & 0x00000000001FFFFF;
+
+			return x;
+		}
+	};
+
+#ifdef __BMI2__
+	inline std::uint32_t deposit_bits(std::uint32_t value, std::uint32_t mask) {return _pdep_u32(value, mask);}
+	inline std::uint64_t deposit_bits(std::uint64_t value, std::uint64_t mask) {return _pdep_u64(value, mask);}
+
+	inline std::uint32_t extract_bits(std::uint32_t value, std::uint32_t mask) {return _pext_u32(value, mask);}
+	inline std::uint64_t extract_bits(std::uint64_t value, std::uint64_t mask) {return _pext_u64(value, mask);}
+#endif
+
+	/// Interleaves coordinates into a code, where coordinate i occupies bits i, i + D, i + 2D, etc. BMI2 does this with a single instruction per coordinate, and otherwise MagicBits is used.
+	template <std::size_t D, typename CodeT>
+	struct Interleave
+	{
+		typedef MagicBits<D, CodeT> MagicBitsT;
+
+		enum : std::size_t {
+			BITS = MagicBitsT::BITS
+		};
+
+		/// The low BITS of value, spread into the bits of the code for coordinate i.
+		static CodeT deposit(CodeT value, std::size_t i)
+		{
+#ifdef __BMI2__
+			return deposit_bits(value, CodeT(CodeT(MagicBitsT::MASK) << i));
+#else
+			return MagicBitsT::spread(value) << i;
+#endif
+		}
+
+		/// The bits of coordinate i from the code.
+		static CodeT extract(CodeT code, std::size_t i)
+		{
+#ifdef __BMI2__
+			return extract_bits(code, CodeT(CodeT(MagicBitsT::MASK) << i));
+#else
+			return MagicBitsT::compact(code >> i);
+#endif
+		}
+	};
+
+	/// Quantizes positions in single precision for encoding as curve coordinates. The significand limits the quantization to 23 bits, so wider coordinates are scaled up by replicating their high bits into the low bits, which maps the bounds to the first and last coordinates.
+	template <std::size_t D, std::size_t BITS>
+	struct CurveQuantization
+	{
+		enum : std::size_t {
+			QUANTIZED_BITS = (BITS < std::numeric_limits<float>::digits) ? BITS : std::numeric_limits<float>::digits - 1,
+			SHIFT = BITS - QUANTIZED_BITS
+		};
+
+		typedef Quantization<D, QUANTIZED_BITS, float> QuantizationT;
+
+		static Vector<D, std::uint32_t> encode(const Vector<D, float> & position, const QuantizationT & quantization)
+		{
+			auto code = quantization.encode(position);
+			Vector<D, std::uint32_t> coordinate;
+
+			for (std::size_t i = 0; i < D; i += 1)
+				coordinate[i] = (std::uint32_t(code[i]) << SHIFT) | (std::uint32_t(code[i]) >> (QUANTIZED_BITS - SHIFT));
+
+			return coordinate;
+		}
+	};
+
+	/// Morton (Z-order) codes, which interleave the bits of the coordinates with the first coordinate in the least significant bit. Points which are close in space are usually close in the order, so sorting by code, e.g. using radix_sort, improves locality. CodeT may be std::uint32_t or std::uint64_t, which determines the number of BITS per coordinate.
+	template <std::size_t D, typename CodeT = std::uint64_t>
+	struct Morton
+	{
+		typedef Interleave<D, CodeT> InterleaveT;
+
+		enum : std::size_t {
+			BITS = InterleaveT::BITS
+		};
+
+		typedef Vector<D, std::uint32_t> CoordinateT;
+		typedef CurveQuantization<D, BITS> CurveQuantizationT;
+		typedef typename CurveQuantizationT::QuantizationT QuantizationT;
+
+		/// Bits of the coordinates above BITS are ignored.
+		static CodeT encode(const CoordinateT & coordinate)
+		{
+			CodeT code = 0;
+
+			for (std::size_t i = 0; i < D; i += 1)
+				code |= InterleaveT::deposit(coordinate[i], i);
+
+			return code;
+		}
+
+		static CoordinateT decode(const CodeT & code)
+		{
+			CoordinateT coordinate;
+
+			for (std::size_t i = 0; i < D; i += 1)
+				coordinate[i] = InterleaveT::extract(code, i);
+
+			return coordinate;
+		}
+
+		static void encode(CodeT * result, const CoordinateT * source, std::size_t count)
+		{
+			for (std::size_t i = 0; i < count; i += 1)
+				result[i] = encode(source[i]);
+		}
+
+		static void decode(CoordinateT * result, const CodeT * source, std::size_t count)
+		{
+			for (std::size_t i = 0; i < count; i += 1)
+				result[i] = decode(source[i]);
+		}
+
+		/// Quantize positions within the bounds of the quantization, and encode the quantized coordinates.
+		static void encode(CodeT * result, const Vector<D, float> * source, std::size_t count, const QuantizationT & quantization)
+		{
+			for (std::size_t i = 0; i < count; i += 1)
+				result[i] = encode(CurveQuantizationT::encode(source[i], quantization));
+		}
+	};
+
+#ifdef NUMERICS_VECTOR_SSE
+	// An optimised specialization for SSE2, which quantizes and encodes four positions at a time:
+	template <> void Morton<3, std::uint32_t>::encode(std::uint32_t * result, const Vector<3, float> * source, std::size_t count, const Quantization<3, 10, float> & quantization);
+#endif
+
+	/// Hilbert curve indices, using Skilling's transform of the coordinates followed by interleaving, as described in "Programming the Hilbert curve" (2004). Consecutive indices are always adjacent, so the locality is better than Morton order, at the cost of a loop over the bits.
+	template <std::size_t D, typename CodeT = std::uint64_t>
+	struct Hilbert
+	{
+		typedef Interleave<D, CodeT> InterleaveT;
+
+		enum : std::size_t {
+			BITS = InterleaveT::BITS
+		};
+
+		typedef Vector<D, std::uint32_t> CoordinateT;
+		typedef CurveQuantization<D, BITS> CurveQuantizationT;
+		typedef typename CurveQuantizationT::QuantizationT QuantizationT;
+
+		/// Bits of the coordinates above BITS are ignored.
+		static CodeT encode(const CoordinateT & coordinate)
+		{
+			const std::uint32_t MAXIMUM = std::uint32_t((std::uint64_t(1) << BITS) - 1);
+			const std::uint32_t HIGH = std::uint32_t(1) << (BITS - 1);
+
+			CoordinateT x = coordinate;
+
+			for (std::size_t i = 0; i < D; i += 1)
+				x[i] &= MAXIMUM;
+
+			// Undo the rotations and reflections of each level, from the highest bit down:
+			for (std::uint32_t q = HIGH; q > 1; q >>= 1) {
+				std::uint32_t p = q - 1;
+
+				for (std::size_t i = 0; i < D; i += 1)
+					transform(x[0], x[i], q, p);
+			}
+
+			// Gray encode:
+			for (std::size_t i = 1; i < D; i += 1)
+				x[i] ^= x[i-1];
+
+			std::uint32_t t = 0;
+
+			for (std::uint32_t q = HIGH; q > 1; q >>= 1)
+				if (x[D-1] & q) t ^= q - 1;
+
+			// The index is the interleaved result, with the first coordinate in the most significant bit of each group:
+			CodeT code = 0;
+
+			for (std::size_t i = 0; i < D; i += 1)
+				code |= InterleaveT::deposit(x[i] ^ t, D - 1 - i);
+
+			return code;
+		}
+
+		static CoordinateT decode(const CodeT & code)
+		{
+			CoordinateT x;
+
+			for (std::size_t i = 0; i < D; i += 1)
+				x[i] = InterleaveT::extract(code, D - 1 - i);
+
+			// Gray decode:
+			std::uint32_t t = x[D-1] >> 1;
+
+			for (std::size_t i = D - 1; i > 0; i -= 1)
+				x[i] ^= x[i-1];
+
+			x[0] ^= t;
+
+			// Apply the rotations and reflections of each level, from the lowest bit up:
+			for (std::uint64_t q = 2; q != (std::uint64_t(1) << BITS); q <<= 1) {
+				std::uint32_t p = std::uint32_t(q - 1);
+
+				for (std::size_t i = D; i > 0; i -= 1)
+					transform(x[0], x[i-1], std::uint32_t(q), p);
+			}
+
+			return x;
+		}
+
+		static void encode(CodeT * result, const CoordinateT * source, std::size_t count)
+		{
+			for (std::size_t i = 0; i < count; i += 1)
+				result[i] = encode(source[i]);
+		}
+
+		static void decode(CoordinateT * result, const CodeT * source, std::size_t count)
+		{
+			for (std::size_t i = 0; i < count; i += 1)
+				result[i] = decode(source[i]);
+		}
+
+		/// Quantize positions within the bounds of the quantization, and encode the quantized coordinates.
+		static void encode(CodeT * result, const Vector<D, float> * source, std::size_t count, const QuantizationT & quantization)
+		{
+			for (std::size_t i = 0; i < count; i += 1)
+				result[i] = encode(CurveQuantizationT::encode(source[i], quantization));
+		}
+
+	private:
+		// If bit q of x is set, invert the low bits p of the first coordinate, otherwise exchange the low bits of the first coordinate and x. This is branchless, because the bits are unpredictable:
+		static void transform(std::uint32_t & first, std::uint32_t & x, std::uint32_t q, std::uint32_t p)
+		{
+			std::uint32_t set = 0 - std::uint32_t((x & q) != 0);
+			std::uint32_t t = (first ^ x) & p & ~set;
+
+			first ^= (p & set) | t;
+			x ^= t;
+		}
+	};
+}
@@ -0,0 +1,337 @@
+//
+//  SSE.cpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include "SSE.hpp"
+
+#ifdef NUMERICS_VECTOR_SSE
+
+#include "Compress.hpp"
+#include "Curve.hpp"
+
+#include <emmintrin.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace Numerics
+{
+	namespace
+	{
+		inline __m128 select(__m128 mask, __m128 a, __m128 b)
+		{
+			return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+		}
+		
+		// Project four unit vectors onto the octahedron and quantize the folded coordinates, as in Octahedral::encode:
+		template <std::size_t BITS>
+		void octahedral_encode_4(const Vector<3, float> * source, __m128i & u, __m128i & v)
+		{
+			const __m128 sign_mask = _mm_set1_ps(-0.0f), one = _mm_set1_ps(1), zero = _mm_setzero_ps();
+			const __m128 half = _mm_set1_ps(((1 << BITS) - 1) * 0.5f), maximum = _mm_set1_ps((1 << BITS) - 1);
+			
+			__m128 x, y, z;
+			const float * p = source[0].data();
+			deinterleave(_mm_loadu_ps(p), _mm_loadu_ps(p + 4), _mm_loadu_ps(p + 8), x, y, z);
+			
+			__m128 scale = _mm_div_ps(one, _mm_add_ps(_mm_add_ps(_mm_andnot_ps(sign_mask, x), _mm_andnot_ps(sign_mask, y)), _mm_andnot_ps(sign_mask, z)));
+			__m128 fu = _mm_mul_ps(x, scale), fv = _mm_mul_ps(y, scale);
+			
+			// (1 - |v|) * sign(u) and (1 - |u|) * sign(v), where the sign of zero is positive:
+			__m128 folded_u = _mm_xor_ps(_mm_sub_ps(one, _mm_andnot_ps(sign_mask, fv)), _mm_and_ps(_mm_cmplt_ps(fu, zero), sign_mask));
+			__m128 folded_v = _mm_xor_ps(_mm_sub_ps(one, _mm_andnot_ps(sign_mask, fu)), _mm_and_ps(_mm_cmplt_ps(fv, zero), sign_mask));
+			
+			__m128 lower = _mm_cmplt_ps(z, zero);
+			fu = select(lower, folded_u, fu);
+			fv = select(lower, folded_v, fv);
+			
+			u = _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_add_ps(fu, one), half), zero), maximum));
+			v = _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_add_ps(fv, one), half), zero), maximum));
+		}
+		
+		// Unfold and normalize four pairs of quantized coordinates, as in Octahedral::decode:
+		template <std::size_t BITS>
+		void octahedral_decode_4(Vector<3, float> * result, __m128i u, __m128i v)
+		{
+			const __m128 sign_mask = _mm_set1_ps(-0.0f), one = _mm_set1_ps(1), zero = _mm_setzero_ps();
+			const __m128 scale = _mm_set1_ps(2.0f / ((1 << BITS) - 1));
+			
+			__m128 x = _mm_sub_ps(_mm_mul_ps(_mm_cvtepi32_ps(u), scale), one);
+			__m128 y = _mm_sub_ps(_mm_mul_ps(_mm_cvtepi32_ps(v), scale), one);
+			__m128 z = _mm_sub_ps(_mm_sub_ps(one, _mm_andnot_ps(sign_mask, x)), _mm_andnot_ps(sign_mask, y));
+			
+			// Move x and y towards zero by t = max(-z, 0):
+			__m128 t = _mm_max_ps(_mm_sub_ps(zero, z), zero);
+			x = _mm_sub_ps(x, _mm_xor_ps(t, _mm_and_ps(_mm_cmplt_ps(x, zero), sign_mask)));
+			y = _mm_sub_ps(y, _mm_xor_ps(t, _mm_and_ps(_mm_cmplt_ps(y, zero), sign_mask)));
+			
+			__m128 length = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z)));
+			__m128 inverse = _mm_div_ps(one, length);
+			
+			__m128 a, b, c;
+			interleave(_mm_mul_ps(x, inverse), _mm_mul_ps(y, inverse), _mm_mul_ps(z, inverse), a, b, c);
+			
+			float * p = result[0].data();
+			_mm_storeu_ps(p, a);
+			_mm_storeu_ps(p + 4, b);
+			_mm_storeu_ps(p + 8, c);
+		}
+		
+		// Quantize four packed Vector<3, float> in the same way as Quantization::encode, so the results are identical:
+		inline void quantize_4(const float * p, const __m128 minimum[3], const __m128 scale[3], __m128 maximum, __m128i code[3])
+		{
+			const __m128 zero = _mm_setzero_ps(), half = _mm_set1_ps(0.5f);
+			
+			__m128 value[3];
+			deinterleave(_mm_loadu_ps(p), _mm_loadu_ps(p + 4), _mm_loadu_ps(p + 8), value[0], value[1], value[2]);
+			
+			for (std::size_t i = 0; i < 3; i += 1)
+				code[i] = _mm_cvttps_epi32(_mm_add_ps(_mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_sub_ps(value[i], minimum[i]), scale[i]), zero), maximum), half));
+		}
+		
+		// The inverse of deinterleave for four quantized vectors:
+		inline void interleave_codes(__m128i code[3], __m128i & a, __m128i & b, __m128i & c)
+		{
+			__m128 fa, fb, fc;
+			interleave(_mm_castsi128_ps(code[0]), _mm_castsi128_ps(code[1]), _mm_castsi128_ps(code[2]), fa, fb, fc);
+			
+			a = _mm_castps_si128(fa);
+			b = _mm_castps_si128(fb);
+			c = _mm_castps_si128(fc);
+		}
+		
+		inline void store_4(std::uint32_t * result, __m128i code[3])
+		{
+			__m128i a, b, c;
+			interleave_codes(code, a, b, c);
+			
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(result), a);
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(result + 4), b);
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(result + 8), c);
+		}
+		
+		// Each value fits in 16 bits, so sign extend it so that the saturating pack keeps the bits unchanged:
+		inline __m128i pack_16(__m128i a, __m128i b)
+		{
+			return _mm_packs_epi32(_mm_srai_epi32(_mm_slli_epi32(a, 16), 16), _mm_srai_epi32(_mm_slli_epi32(b, 16), 16));
+		}
+		
+		inline void store_4(std::uint16_t * result, __m128i code[3])
+		{
+			__m128i a, b, c;
+			interleave_codes(code, a, b, c);
+			
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(result), pack_16(a, b));
+			_mm_storel_epi64(reinterpret_cast<__m128i *>(result + 8), pack_16(c, c));
+		}
+		
+		inline void store_4(std::uint8_t * result, __m128i code[3])
+		{
+			__m128i a, b, c;
+			interleave_codes(code, a, b, c);
+			
+			__m128i packed = _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, c));
+			std::uint32_t last = _mm_cvtsi128_si32(_mm_srli_si128(packed, 8));
+			
+			_mm_storel_epi64(reinterpret_cast<__m128i *>(result), packed);
+			std::memcpy(result + 8, &last, sizeof(last));
+		}
+		
+		template <typename IntegerT>
+		void quantize_array(IntegerT * result, const float * source, std::size_t count, const float * minimum, const float * inverse_step, float maximum)
+		{
+			const __m128 minimum_4[3] = {_mm_set1_ps(minimum[X]), _mm_set1_ps(minimum[Y]), _mm_set1_ps(minimum[Z])};
+			const __m128 scale_4[3] = {_mm_set1_ps(inverse_step[X]), _mm_set1_ps(inverse_step[Y]), _mm_set1_ps(inverse_step[Z])};
+			const __m128 maximum_4 = _mm_set1_ps(maximum);
+			
+			std::size_t i = 0;
+			
+			for (; i + 4 <= count; i += 4) {
+				__m128i code[3];
+				quantize_4(source + i * 3, minimum_4, scale_4, maximum_4, code);
+				
+				store_4(result + i * 3, code);
+			}
+			
+			for (; i < count; i += 1)
+				for (std::size_t j = 0; j < 3; j += 1)
+					result[i * 3 + j] = IntegerT(std::min(std::max((source[i * 3 + j] - minimum[j]) * inverse_step[j], 0.0f), maximum) + 0.5f);
+		}
+		
+		// Spread the low 10 bits of each lane, as in MagicBits<3, std::uint32_t>::spread:
+		inline __m128i spread_3(__m128i x)
+		{
+			x = _mm_and_si128(_mm_or_si128(x, _mm_slli_epi32(x, 16)), _mm_set1_epi32(0x030000FF));
+			x = _mm_and_si128(_mm_or_si128(x, _mm_slli_epi32(x, 8)), _mm_set1_epi32(0x0300F00F));
+			x = _mm_and_si128(_mm_or_si128(x, _mm_slli_epi32(x, 4)), _mm_set1_epi32(0x030C30C3));
+			x = _mm_and_si128(_mm_or_si128(x, _mm_slli_epi32(x, 2)), _mm_set1_epi32(0x09249249));
+			
+			return x;
+		}
+	}
+	
+	template <>
+	void Octahedral<8, std::uint16_t>::encode(std::uint16_t * result, const Vector<3, float> * source, std::size_t count)
+	{
+		std::size_t i = 0;
+		
+		for (; i + 4 <= count; i += 4) {
+			__m128i u, v;
+			octahedral_encode_4<8>(source + i, u, v);
+			
+			// Each value fits in 16 bits, so sign extend it so that the saturating pack keeps the bits unchanged:
+			__m128i value = _mm_or_si128(_mm_slli_epi32(u, 8), v);
+			value = _mm_srai_epi32(_mm_slli_epi32(value, 16), 16);
+			
+			_mm_storel_epi64(reinterpret_cast<__m128i *>(result + i), _mm_packs_epi32(value, value));
+		}
+		
+		for (; i < count; i += 1)
+			result[i] = encode(source[i]);
+	}
+	
+	template <>
+	void Octahedral<8, std::uint16_t>::decode(Vector<3, float> * result, const std::uint16_t * source, std::size_t count)
+	{
+		const __m128i mask = _mm_set1_epi32(0xFF);
+		std::size_t i = 0;
+		
+		for (; i + 4 <= count; i += 4) {
+			__m128i value = _mm_unpacklo_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(source + i)), _mm_setzero_si128());
+			
+			octahedral_decode_4<8>(result + i, _mm_srli_epi32(value, 8), _mm_and_si128(value, mask));
+		}
+		
+		for (; i < count; i += 1)
+			result[i] = decode(source[i]);
+	}
+	
+	template <>
+	void Octahedral<16, std::uint32_t>::encode(std::uint32_t * result, const Vector<3, float> * source, std::size_t count)
+	{
+		std::size_t i = 0;
+		
+		for (; i + 4 <= count; i += 4) {
+			__m128i u, v;
+			octahedral_encode_4<16>(source + i, u, v);
+			
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(result + i), _mm_or_si128(_mm_slli_epi32(u, 16), v));
+		}
+		
+		for (; i < count; i += 1)
+			result[i] = encode(source[i]);
+	}
+	
+	template <>
+	void Octahedral<16, std::uint32_t>::decode(Vector<3, float> * result, const std::uint32_t * source, std::size_t count)
+	{
+		const __m128i mask = _mm_set1_epi32(0xFFFF);
+		std::size_t i = 0;
+		
+		for (; i + 4 <= count; i += 4) {
+			__m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + i));
+			
+			octahedral_decode_4<16>(result + i, _mm_srli_epi32(value, 16), _mm_and_si128(value, mask));
+		}
+		
+		for (; i < count; i += 1)
+			result[i] = decode(source[i]);
+	}
+	
+	template <>
+	void Octahedral<12, UInt24>::encode(UInt24 * result, const Vector<3, float> * source, std::size_t count)
+	{
+		static_assert(sizeof(UInt24) == 3, "UInt24 must be packed!");
+		
+		const __m128i low = _mm_set_epi32(0, -1, 0, -1);
+		std::size_t i = 0;
+		
+		for (; i + 4 <= count; i += 4) {
+			__m128i u, v;
+			octahedral_encode_4<12>(source + i, u, v);
+			
+			// Pack pairs of 24-bit values into the low 48 bits of each half, and then the two halves into 12 bytes:
+			__m128i value = _mm_or_si128(_mm_slli_epi32(u, 12), v);
+			__m128i pairs = _mm_or_si128(_mm_and_si128(value, low), _mm_srli_epi64(_mm_andnot_si128(low, value), 8));
+			__m128i packed = _mm_or_si128(_mm_move_epi64(pairs), _mm_slli_si128(_mm_srli_si128(pairs, 8), 6));
+			
+			std::uint8_t * bytes = reinterpret_cast<std::uint8_t *>(result + i);
+			std::uint32_t last = _mm_cvtsi128_si32(_mm_srli_si128(packed, 8));
+			
+			_mm_storel_epi64(reinterpret_cast<__m128i *>(bytes), packed);
+			std::memcpy(bytes + 8, &last, sizeof(last));
+		}
+		
+		for (; i < count; i += 1)
+			result[i] = encode(source[i]);
+	}
+	
+	template <>
+	void Octahedral<12, UInt24>::decode(Vector<3, float> * result, const UInt24 * source, std::size_t count)
+	{
+		const __m128i low = _mm_set_epi32(0, 0xFFFFFF, 0, 0xFFFFFF), low_48 = _mm_set_epi32(0xFFFF, -1, 0xFFFF, -1), mask = _mm_set1_epi32(0xFFF);
+		std::size_t i = 0;
+		
+		for (; i + 4 <= count; i += 4) {
+			const std::uint8_t * bytes = reinterpret_cast<const std::uint8_t *>(source + i);
+			
+			std::uint32_t last;
+			std::memcpy(&last, bytes + 8, sizeof(last));
+			
+			// Unpack the two 48-bit halves of the 12 bytes, and then each pair of 24-bit values:
+			__m128i packed = _mm_unpacklo_epi64(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(bytes)), _mm_cvtsi32_si128(last));
+			__m128i pairs = _mm_and_si128(_mm_unpacklo_epi64(packed, _mm_srli_si128(packed, 6)), low_48);
+			__m128i value = _mm_or_si128(_mm_and_si128(pairs, low), _mm_slli_epi64(_mm_srli_epi64(pairs, 24), 32));
+			
+			octahedral_decode_4<12>(result + i, _mm_srli_epi32(value, 12), _mm_and_si128(value, mask));
+		}
+		
+		for (; i < count; i += 1)
+			result[i] = decode(source[i]);
+	}
+	
+	void quantize_3(std::uint8_t * result, const float * source, std::size_t count, const float * minimum, const float * inverse_step, float maximum)
+	{
+		quantize_array(result, source, count, minimum, inverse_step, maximum);
+	}
+	
+	void quantize_3(std::uint16_t * result, const float * source, std::size_t count, const float * minimum, const float * inverse_step, float maximum)
+	{
+		quantize_array(result, source, count, minimum, inverse_step, maximum);
+	}
+	
+	void quantize_3(std::uint32_t * result, const float * source, std::size_t count, const float * minimum, const float * inverse_step, float maximum)
+	{
+		quantize_array(result, source, count, minimum, inverse_step, maximum);
+	}
+	
+	template <>
+	void Morton<3, std::uint32_t>::encode(std::uint32_t * result, const Vector<3, float> * source, std::size_t count, const Quantization<3, 10, float> & quantization)
+	{
+		const auto & minimum = quantization.minimum();
+		const auto & inverse_step = quantization.inverse_step();
+		
+		const __m128 minimum_4[3] = {_mm_set1_ps(minimum[X]), _mm_set1_ps(minimum[Y]), _mm_set1_ps(minimum[Z])};
+		const __m128 scale_4[3] = {_mm_set1_ps(inverse_step[X]), _mm_set1_ps(inverse_step[Y]), _mm_set1_ps(inverse_step[Z])};
+		const __m128 maximum = _mm_set1_ps(1023);
+		
+		std::size_t i = 0;
+		
+		for (; i + 4 <= count; i += 4) {
+			__m128i code[3];
+			quantize_4(source[i].data(), minimum_4, scale_4, maximum, code);
+			
+			__m128i morton = _mm_or_si128(_mm_or_si128(spread_3(code[X]), _mm_slli_epi32(spread_3(code[Y]), 1)), _mm_slli_epi32(spread_3(code[Z]), 2));
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(result + i), morton);
+		}
+		
+		for (; i < count; i += 1)
+			result[i] = encode(CoordinateT(quantization.encode(source[i])));
+	}
+}
+
+#endif
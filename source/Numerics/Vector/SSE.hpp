@@ -0,0 +1,38 @@
+//
+//  SSE.hpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#pragma once
+
+#ifdef __SSE2__
+
+#define NUMERICS_VECTOR_SSE
+
+#include <xmmintrin.h>
+
+namespace Numerics
+{
+	// Convert four packed Vector<3, float> (12 floats, loaded as a, b and c) into one register per component:
+	inline void deinterleave(__m128 a, __m128 b, __m128 c, __m128 & x, __m128 & y, __m128 & z)
+	{
+		__m128 t = _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 1, 3, 2)); // x2 y2 x3 y3
+		
+		x = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 0, 3, 0)), t, _MM_SHUFFLE(2, 0, 1, 0));
+		y = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 2, 1)), t, _MM_SHUFFLE(3, 1, 2, 0));
+		z = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)), _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+	}
+	
+	// The inverse of deinterleave:
+	inline void interleave(__m128 x, __m128 y, __m128 z, __m128 & a, __m128 & b, __m128 & c)
+	{
+		a = _mm_shuffle_ps(_mm_unpacklo_ps(x, y), _mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 1, 0));
+		b = _mm_shuffle_ps(_mm_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1)), _mm_unpackhi_ps(x, y), _MM_SHUFFLE(1, 0, 2, 0));
+		c = _mm_shuffle_ps(_mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2)), _mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+	}
+}
+
+#endif
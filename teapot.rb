@@ -48,6 +48,20 @@ define_target 'numerics-test' do |target|
 	end
 end
 
+define_target 'numerics-accuracy' do |target|
+	target.depends 'Language/C++14'
+	
+	target.depends 'Library/Numerics'
+	
+	target.provides 'Accuracy/Numerics' do |*arguments|
+		source_root = target.package.path + 'accuracy'
+		
+		executable_path = build executable: 'NumericsAccuracy', source_files: source_root.glob('Numerics/**/*.cpp')
+		
+		run executable: executable_path, arguments: arguments
+	end
+end
+
 # Configurations
 
 define_configuration 'development' do |configuration|
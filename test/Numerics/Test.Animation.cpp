@@ -0,0 +1,218 @@
+//
+//  Test.Animation.cpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Numerics/Animation.hpp>
+#include <Numerics/Vector/IO.hpp>
+
+#include <random>
+
+namespace Numerics
+{
+	using namespace UnitTest::Expectations;
+	using namespace Animation;
+
+	UnitTest::Suite AnimationTestSuite {
+		"Numerics::Animation",
+
+		{"it interpolates vectors, rotations and scalars",
+			[](UnitTest::Examiner & examiner) {
+				Track<float> track;
+
+				auto position = track.add_channel(3);
+				auto rotation = track.add_channel(4, SPHERICAL_LINEAR);
+				auto weight = track.add_channel(1);
+
+				examiner.expect(track.width()) == 8;
+
+				Quaternion<float> r0 = IDENTITY, r1(R90, Vector<3, float>{0, 0, 1});
+
+				track.add_key(0);
+				track.set(0, position, Vector<3, float>{0, 0, 0});
+				track.set(0, rotation, static_cast<const Vector<4, float> &>(r0));
+				track.key(0)[weight] = 1;
+
+				track.add_key(2);
+				track.set(1, position, Vector<3, float>{2, 4, 6});
+				track.set(1, rotation, static_cast<const Vector<4, float> &>(r1));
+				track.key(1)[weight] = 3;
+
+				Cursor cursor;
+				float result[8];
+
+				track.sample(0.5f, cursor, result);
+
+				auto p = Track<float>::vector<3>(result, position);
+				auto q = Track<float>::quaternion(result, rotation);
+
+				examiner << "Position: " << p << " rotation: " << static_cast<const Vector<4, float> &>(q) << std::endl;
+
+				examiner.check(p.equivalent({0.5f, 1, 1.5f}));
+				examiner.check(q.equivalent(Quaternion<float>(R90 / 4.0, Vector<3, float>{0, 0, 1})));
+				examiner.check(equivalent(result[weight], 1.5f));
+			}
+		},
+
+		{"it clamps to the first and last keys",
+			[](UnitTest::Examiner & examiner) {
+				Track<double> track;
+				track.add_channel(1);
+
+				track.add_key(1)[0] = 10;
+				track.add_key(2)[0] = 20;
+
+				Cursor cursor;
+				double result;
+
+				track.sample(-5, cursor, &result);
+				examiner.expect(result) == 10;
+
+				track.sample(5, cursor, &result);
+				examiner.expect(result) == 20;
+
+				Track<double> single;
+				single.add_channel(1);
+				single.add_key(0)[0] = 7;
+
+				single.sample(3, cursor, &result);
+				examiner.expect(result) == 7;
+			}
+		},
+
+		{"step interpolation holds each key",
+			[](UnitTest::Examiner & examiner) {
+				Track<float> track(STEP);
+				track.add_channel(1);
+
+				track.add_key(0)[0] = 1;
+				track.add_key(1)[0] = 2;
+				track.add_key(2)[0] = 3;
+
+				Cursor cursor;
+				float result;
+
+				track.sample(0.99f, cursor, &result);
+				examiner.expect(result) == 1;
+
+				track.sample(1.0f, cursor, &result);
+				examiner.expect(result) == 2;
+
+				track.sample(2.5f, cursor, &result);
+				examiner.expect(result) == 3;
+			}
+		},
+
+		{"normalized linear rotations take the shorter path",
+			[](UnitTest::Examiner & examiner) {
+				Track<float> track;
+				auto rotation = track.add_channel(4, NORMALIZED_LINEAR);
+
+				// The same rotation as r1, but on the other side of the hypersphere:
+				Quaternion<float> r0 = IDENTITY, r1(R90, Vector<3, float>{0, 1, 0});
+
+				track.add_key(0);
+				track.set(0, rotation, static_cast<const Vector<4, float> &>(r0));
+				track.add_key(1);
+				track.set(1, rotation, -static_cast<const Vector<4, float> &>(r1));
+
+				Cursor cursor;
+				float result[4];
+
+				track.sample(0.5f, cursor, result);
+
+				examiner.check(Track<float>::quaternion(result, 0).equivalent(Quaternion<float>(R45, Vector<3, float>{0, 1, 0})));
+			}
+		},
+
+		{"sequential playback follows the cursor",
+			[](UnitTest::Examiner & examiner) {
+				Track<float> track;
+				track.add_channel(2);
+
+				for (std::size_t i = 0; i < 100; i += 1) {
+					float * key = track.add_key(i * 0.5f);
+					key[0] = i;
+					key[1] = std::sin(i * 0.1f);
+				}
+
+				Cursor cursor, playback;
+				std::size_t mismatches = 0;
+
+				for (float time = 0; time < 50; time += 0.1f) {
+					float a[2], b[2];
+
+					// A fresh cursor always searches:
+					Cursor search;
+					track.sample(time, search, a);
+					track.sample(time, playback, b);
+
+					if (a[0] != b[0] || a[1] != b[1] || search.key != playback.key) mismatches += 1;
+				}
+
+				examiner.expect(mismatches) == 0;
+				examiner.expect(playback.key) == 98;
+
+				// Seeking backwards searches again:
+				examiner.expect(track.find(10.25f, playback)) == 20;
+				examiner.expect(playback.key) == 20;
+			}
+		},
+
+		{"it samples batches of instances and tracks",
+			[](UnitTest::Examiner & examiner) {
+				Track<float> walk, run;
+
+				for (auto track : {&walk, &run}) {
+					track->add_channel(3);
+					track->add_channel(4, SPHERICAL_LINEAR);
+
+					for (std::size_t i = 0; i < 10; i += 1) {
+						float * key = track->add_key(i);
+						Quaternion<float> q(Radians<float>(i * 0.3f), Vector<3, float>{1, 0, 0});
+
+						key[0] = i; key[1] = i * 2; key[2] = (track == &run) ? i * 3 : 0;
+						std::copy(q.begin(), q.end(), key + 3);
+					}
+				}
+
+				std::minstd_rand random(7);
+				std::uniform_real_distribution<float> uniform(0, 9);
+
+				const std::size_t COUNT = 33;
+				std::vector<float> times(COUNT), results(COUNT * walk.width()), individual(walk.width());
+				std::vector<Cursor> cursors(COUNT);
+
+				for (auto & time : times) time = uniform(random);
+
+				walk.sample(COUNT, times.data(), cursors.data(), results.data());
+
+				std::size_t mismatches = 0;
+
+				for (std::size_t i = 0; i < COUNT; i += 1) {
+					Cursor cursor;
+					walk.sample(times[i], cursor, individual.data());
+
+					if (!std::equal(individual.begin(), individual.end(), results.begin() + i * walk.width())) mismatches += 1;
+				}
+
+				examiner.expect(mismatches) == 0;
+
+				const Track<float> * tracks[] = {&walk, &run};
+				float a[7], b[7];
+				float * rows[] = {a, b};
+				Cursor pair[2];
+
+				sample(2, tracks, times.data(), pair, rows);
+
+				examiner.check(equivalent(b[2], times[1] * 3));
+				examiner.check(equivalent(a[2], 0.0f));
+			}
+		},
+	};
+}
@@ -0,0 +1,122 @@
+//
+//  Test.ConjugateGradient.cpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Numerics/ConjugateGradient.hpp>
+#include <Numerics/Parallel/ThreadPool.hpp>
+
+namespace Numerics
+{
+	/// A symmetric positive definite system resembling a chain of springs, with coupling between the axes of each node.
+	template <typename NumericT>
+	BlockSparseMatrix<3, 3, NumericT> spring_chain(std::size_t size) {
+		std::vector<Triplet<Matrix<3, 3, NumericT>>> triplets;
+
+		Matrix<3, 3, NumericT> stiffness(IDENTITY), coupling(ZERO);
+		stiffness.at(0, 1) = stiffness.at(1, 0) = 0.5;
+		stiffness.at(1, 2) = stiffness.at(2, 1) = 0.25;
+
+		for (std::size_t i = 0; i < 3; i += 1) coupling.at(i, i) = -1;
+
+		for (std::size_t i = 0; i < size; i += 1) {
+			Matrix<3, 3, NumericT> diagonal = stiffness;
+			for (std::size_t j = 0; j < 3; j += 1) diagonal.at(j, j) = 2.5 + NumericT(i % 3);
+
+			triplets.push_back({i, i, diagonal});
+
+			if (i > 0) {
+				triplets.push_back({i, i - 1, coupling});
+				triplets.push_back({i - 1, i, coupling});
+			}
+		}
+
+		return {size, size, triplets};
+	}
+
+	template <typename NumericT, typename SolverT>
+	bool check_solution(SolverT & solver, const BlockSparseMatrix<3, 3, NumericT> & matrix, UnitTest::Examiner & examiner) {
+		std::size_t size = matrix.rows();
+		std::vector<Vector<3, NumericT>> expected(size), b(size, ZERO), x(size, ZERO);
+
+		for (std::size_t i = 0; i < size; i += 1)
+			expected[i] = {NumericT(i % 7), NumericT(1), -NumericT(i % 3)};
+
+		multiply(b, matrix, expected);
+
+		auto result = solver.solve(x, b);
+
+		examiner << "Converged after " << result.iterations << " iterations with residual " << result.residual << std::endl;
+
+		if (!result.converged) return false;
+
+		for (std::size_t i = 0; i < size; i += 1)
+			if ((x[i] - expected[i]).length() > 1e-4)
+				return false;
+
+		return true;
+	}
+
+	UnitTest::Suite ConjugateGradientTestSuite {
+		"Numerics::ConjugateGradient",
+
+		{"it can invert 3x3 matrices",
+			[](UnitTest::Examiner & examiner) {
+				Matrix<3, 3, double> m = Transforms::rotate(R30, vector(0.0, 0.6, 0.8));
+				m.at(0, 0) = 3;
+
+				examiner.check((m * inverse(m)).equivalent(IDENTITY));
+			}
+		},
+
+		{"it can solve with the identity preconditioner",
+			[](UnitTest::Examiner & examiner) {
+				auto matrix = spring_chain<double>(100);
+				Parallel::SerialExecutor serial;
+				ConjugateGradient<3, double, IdentityPreconditioner<3, double>> solver(matrix, serial);
+
+				examiner.check(check_solution(solver, matrix, examiner));
+			}
+		},
+
+		{"it can solve with the jacobi preconditioner",
+			[](UnitTest::Examiner & examiner) {
+				auto matrix = spring_chain<double>(100);
+				Parallel::ThreadPool pool(3);
+				ConjugateGradient<3, double> solver(matrix, pool);
+				solver.grain = 16;
+
+				examiner.check(check_solution(solver, matrix, examiner));
+			}
+		},
+
+		{"it can solve with the block jacobi preconditioner",
+			[](UnitTest::Examiner & examiner) {
+				auto matrix = spring_chain<float>(100);
+				ConjugateGradient<3, float, BlockJacobiPreconditioner<3, float>> solver(matrix);
+
+				examiner.check(check_solution(solver, matrix, examiner));
+			}
+		},
+
+		{"it stops after the maximum number of iterations",
+			[](UnitTest::Examiner & examiner) {
+				auto matrix = spring_chain<double>(100);
+				ConjugateGradient<3, double> solver(matrix);
+				solver.maximum_iterations = 2;
+
+				std::vector<Vector<3, double>> x(100, ZERO), b(100, Vector<3, double>(1, 2, 3));
+
+				auto result = solver.solve(x, b);
+
+				examiner.check(!result.converged);
+				examiner.check_equal(result.iterations, 2);
+			}
+		},
+	};
+}
@@ -0,0 +1,90 @@
+//
+//  Test.DualQuaternion.cpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Numerics/DualQuaternion.hpp>
+
+namespace Numerics
+{
+	using namespace UnitTest::Expectations;
+
+	UnitTest::Suite DualQuaternionTestSuite {
+		"Numerics::DualQuaternion",
+
+		{"it can transform points",
+			[](UnitTest::Examiner & examiner) {
+				Quaternion<float> rotation(90_deg, Vec3(0, 0, 1));
+				DualQuaternion<float> transform(rotation, Vec3(1, 2, 3));
+
+				examiner.expect(transform.translation()).to(be_equivalent(Vec3(1, 2, 3)));
+				examiner.expect(transform * Vec3(1, 0, 0)).to(be_equivalent(Vec3(1, 3, 3)));
+
+				Mat44 matrix = transform;
+				examiner.expect(matrix * Vec3(4, 5, 6)).to(be_equivalent(transform * Vec3(4, 5, 6)));
+
+				DualQuaternion<float> copy(matrix);
+				examiner.check(copy.equivalent(transform));
+			}
+		},
+
+		{"it can compose transforms",
+			[](UnitTest::Examiner & examiner) {
+				DualQuaternion<double> a(Quaternion<double>(30_deg, Vector<3, double>(1, 0, 0)), Vector<3, double>(1, -2, 0.5));
+				DualQuaternion<double> b(Quaternion<double>(-75_deg, Vector<3, double>(0, 1, 1).normalize()), Transforms::translate(Vector<3, double>(3, 0, 1)));
+
+				Vector<3, double> p(0.25, 1, -4);
+
+				examiner.expect((a * b) * p).to(be_equivalent(a * (b * p)));
+				examiner.expect(Matrix<4, 4, double>(a * b) * p).to(be_equivalent(Matrix<4, 4, double>(a) * Matrix<4, 4, double>(b) * p));
+
+				examiner << "Conjugate is the inverse." << std::endl;
+				examiner.expect(a.conjugate() * (a * p)).to(be_equivalent(p));
+
+				examiner.check((a * b).normalize().equivalent(a * b));
+			}
+		},
+
+		{"it can blend transforms",
+			[](UnitTest::Examiner & examiner) {
+				std::vector<DualQuaternion<float>> bones;
+
+				for (std::size_t i = 0; i < 6; i += 1)
+					bones.push_back({Quaternion<float>(Radians<float>(i * 0.5f), Vec3(1, i, 2).normalize()), Vec3(i, 1, -1.0f * i)});
+
+				// The same rotation with the opposite sign must blend to the same result:
+				bones[5] = {Quaternion<float>(-bones[0].real), Quaternion<float>(-bones[0].dual)};
+
+				std::vector<Vector<4, std::uint32_t>> indices = {{0, 1, 2, 3}, {5, 4, 3, 2}, {0, 5, 0, 5}, {1, 1, 1, 1}, {2, 3, 4, 5}};
+				std::vector<Vec4> weights = {{0.25, 0.25, 0.25, 0.25}, {0.7, 0.1, 0.1, 0.1}, {0.5, 0.5, 0, 0}, {1, 0, 0, 0}, {0.1, 0.2, 0.3, 0.4}};
+
+				std::vector<DualQuaternion<float>> result(indices.size());
+				blend(result.data(), bones.data(), indices.data(), weights.data(), indices.size());
+
+				examiner << "Blending a transform with its negation gives the transform." << std::endl;
+				examiner.expect(result[2] * Vec3(1, 2, 3)).to(be_equivalent(bones[0] * Vec3(1, 2, 3)));
+				examiner.expect(result[3] * Vec3(1, 2, 3)).to(be_equivalent(bones[1] * Vec3(1, 2, 3)));
+
+				bool unit = true;
+				for (auto & transform : result)
+					unit = unit && transform.real.length().equivalent(1);
+				examiner.check(unit);
+
+				// Compare with the generic implementation:
+				std::vector<Vector<4, std::size_t>> wide_indices(indices.begin(), indices.end());
+				std::vector<DualQuaternion<float>> expected(indices.size());
+				blend(expected.data(), bones.data(), wide_indices.data(), weights.data(), indices.size());
+
+				bool matches = true;
+				for (std::size_t i = 0; i < result.size(); i += 1)
+					matches = matches && result[i].equivalent(expected[i]);
+				examiner.check(matches);
+			}
+		},
+	};
+}
@@ -0,0 +1,98 @@
+//
+//  Test.DynamicMatrix.cpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Numerics/DynamicMatrix.hpp>
+
+namespace Numerics
+{
+	/// Load a small repeating pattern into the matrix. Used for testing.
+	template <typename NumericT>
+	void load_test_pattern(DynamicMatrix<NumericT> & matrix) {
+		for (std::size_t i = 0; i < matrix.size(); i += 1)
+			matrix[i] = NumericT((i * 7) % 11) - 5;
+	}
+
+	template <typename NumericT>
+	DynamicMatrix<NumericT> naive_multiply(const DynamicMatrix<NumericT> & left, const DynamicMatrix<NumericT> & right) {
+		DynamicMatrix<NumericT> result(left.rows(), right.columns());
+
+		for (std::size_t r = 0; r < left.rows(); r += 1)
+			for (std::size_t c = 0; c < right.columns(); c += 1)
+				for (std::size_t t = 0; t < left.columns(); t += 1)
+					result.at(r, c) += left.at(r, t) * right.at(t, c);
+
+		return result;
+	}
+
+	UnitTest::Suite DynamicMatrixTestSuite {
+		"Numerics::DynamicMatrix",
+
+		{"it can be constructed from a matrix",
+			[](UnitTest::Examiner & examiner) {
+				Mat44 m(IDENTITY);
+				DynamicMatrix<float> d = m;
+
+				examiner.check_equal(d.rows(), 4);
+				examiner.check_equal(d.columns(), 4);
+				examiner.check(d == DynamicMatrix<float>(4, 4, IDENTITY));
+				examiner.check(Mat44(d) == m);
+			}
+		},
+
+		{"it can multiply matrices with ragged edges",
+			[](UnitTest::Examiner & examiner) {
+				DynamicMatrix<float> a(37, 53), b(53, 29);
+				load_test_pattern(a);
+				load_test_pattern(b);
+
+				examiner.check(a * b == naive_multiply(a, b));
+			}
+		},
+
+		{"it can multiply matrices larger than a cache block",
+			[](UnitTest::Examiner & examiner) {
+				DynamicMatrix<double> a(301, 517), b(517, 7);
+				load_test_pattern(a);
+				load_test_pattern(b);
+
+				examiner.check(a * b == naive_multiply(a, b));
+			}
+		},
+
+		{"it can multiply a matrix by a vector",
+			[](UnitTest::Examiner & examiner) {
+				DynamicMatrix<float> a(9, 7);
+				load_test_pattern(a);
+
+				DynamicMatrix<float> x(7, 1);
+				load_test_pattern(x);
+
+				DynamicVector<float> v(x.begin(), x.end());
+				auto y = a * v;
+
+				auto expected = naive_multiply(a, x);
+				examiner.check(std::equal(y.begin(), y.end(), expected.begin()));
+			}
+		},
+
+		{"it can be transposed",
+			[](UnitTest::Examiner & examiner) {
+				DynamicMatrix<int> m(2, 3);
+				load_test_pattern(m);
+
+				auto mt = m.transpose();
+
+				examiner.check_equal(mt.rows(), 3);
+				examiner.check_equal(m.at(0, 1), mt.at(1, 0));
+				examiner.check_equal(m.at(1, 2), mt.at(2, 1));
+			}
+		},
+	};
+}
@@ -0,0 +1,58 @@
+//
+//  Test.DynamicVector.cpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Numerics/DynamicVector.hpp>
+
+namespace Numerics
+{
+	using namespace UnitTest::Expectations;
+
+	UnitTest::Suite DynamicVectorTestSuite {
+		"Numerics::DynamicVector",
+
+		{"it has aligned storage",
+			[](UnitTest::Examiner & examiner) {
+				DynamicVector<float> a(3);
+
+				examiner.check_equal(reinterpret_cast<std::uintptr_t>(a.data()) % ALIGNMENT, 0);
+			}
+		},
+
+		{"it can do basic vector arithmetic",
+			[](UnitTest::Examiner & examiner) {
+				DynamicVector<float> a = {1, 2, 3, 4, 5}, b = {-1, 2, -3, 4, -5};
+
+				examiner.expect(a + b) == DynamicVector<float>{0, 4, 0, 8, 0};
+				examiner.expect(a - b) == DynamicVector<float>{2, 0, 6, 0, 10};
+				examiner.expect(a * 2.0f) == DynamicVector<float>{2, 4, 6, 8, 10};
+			}
+		},
+
+		{"it can compute dot products and norms",
+			[](UnitTest::Examiner & examiner) {
+				DynamicVector<double> a = {1, 2, 3, 4, 5}, b = {5, 4, 3, 2, 1};
+
+				examiner.expect(dot(a, b)) == 35;
+				examiner.expect(DynamicVector<double>(16, 2.0).length()) == 8;
+
+				axpy(2.0, a, b);
+				examiner.expect(b) == DynamicVector<double>{7, 8, 9, 10, 11};
+			}
+		},
+
+		{"it computes norms without overflow",
+			[](UnitTest::Examiner & examiner) {
+				DynamicVector<float> a = {3e30f, 4e30f};
+
+				examiner.expect(nrm2(a)).to(be_equivalent(5e30f));
+			}
+		},
+	};
+}
@@ -0,0 +1,194 @@
+//
+//  Test.Fixed.cpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Numerics/Fixed.hpp>
+#include <Numerics/Fixed/IO.hpp>
+#include <Numerics/Vector.hpp>
+#include <Numerics/Matrix.hpp>
+#include <Numerics/Quaternion.hpp>
+#include <Numerics/Vector/IO.hpp>
+
+#include <random>
+#include <vector>
+
+namespace Numerics
+{
+	using namespace UnitTest::Expectations;
+
+	typedef Fixed<16, 16, WRAP> Wrapping16x16;
+
+	// The distance between a fixed point value and the exact result, in units of the last place:
+	template <typename FixedT>
+	double units(const FixedT & value, double expected)
+	{
+		return std::abs(double(value) - expected) * (1 << FixedT::FRACTION_BITS);
+	}
+
+	UnitTest::Suite FixedTestSuite {
+		"Numerics::Fixed",
+
+		{"it can do arithmetic",
+			[](UnitTest::Examiner & examiner) {
+				Fixed16x16 a = 1.5, b = -2.25;
+
+				examiner.expect(double(a + b)) == -0.75;
+				examiner.expect(double(a - b)) == 3.75;
+				examiner.expect(double(a * b)) == -3.375;
+				examiner.expect(double(b / a)) == -1.5;
+				examiner.expect(double(-b)) == 2.25;
+				examiner.expect(double(a * 2)) == 3.0;
+				examiner.expect(double(2 + a)) == 3.5;
+
+				examiner.expect(int(b)) == -3;
+				examiner.expect(a < b).to(be_false);
+				examiner.expect(abs(b) == 2.25).to(be_true);
+
+				a += 1;
+				a *= 2;
+				examiner.expect(double(a)) == 5.0;
+			}
+		},
+
+		{"it rounds to nearest",
+			[](UnitTest::Examiner & examiner) {
+				Fixed<8, 8> a = 0.00390625, b = 0.5;
+
+				// Half a unit rounds up, as do the values between:
+				examiner.expect((a * b).bits) == 1;
+				examiner.expect(Fixed<8, 8>(0.001).bits) == 0;
+				examiner.expect(Fixed<8, 8>(0.002).bits) == 1;
+				examiner.expect(Fixed<8, 8>(-0.002).bits) == -1;
+			}
+		},
+
+		{"it saturates or wraps",
+			[](UnitTest::Examiner & examiner) {
+				auto maximum = std::numeric_limits<Fixed16x16>::max(), minimum = std::numeric_limits<Fixed16x16>::min();
+
+				examiner.expect(maximum + 1 == maximum).to(be_true);
+				examiner.expect(minimum - 1 == minimum).to(be_true);
+				examiner.expect(-minimum == maximum).to(be_true);
+				examiner.expect(Fixed16x16(1000) * Fixed16x16(1000) == maximum).to(be_true);
+				examiner.expect(Fixed16x16(-1000) * Fixed16x16(1000) == minimum).to(be_true);
+				examiner.expect(Fixed16x16(1e10) == maximum).to(be_true);
+				examiner.expect(Fixed16x16(1) / Fixed16x16(0) == maximum).to(be_true);
+				examiner.expect(Fixed16x16(-1) / Fixed16x16(0) == minimum).to(be_true);
+
+				auto wrapped = std::numeric_limits<Wrapping16x16>::max() + Wrapping16x16(FROM_BITS, 1);
+				examiner.expect(wrapped == std::numeric_limits<Wrapping16x16>::min()).to(be_true);
+				examiner.expect(int(Wrapping16x16(32767) + 1)) == -32768;
+			}
+		},
+
+		{"it has accurate functions",
+			[](UnitTest::Examiner & examiner) {
+				double sqrt_error = 0, reciprocal_error = 0, sin_error = 0, cos_error = 0;
+
+				for (std::int32_t bits = 1; bits < (1 << 30); bits += 98321) {
+					Fixed16x16 value(FROM_BITS, bits);
+					double x = double(value);
+
+					sqrt_error = std::max(sqrt_error, units(sqrt(value), std::sqrt(x)));
+
+					// Smaller values have reciprocals which are out of range:
+					if (x > 1.0 / 32767)
+						reciprocal_error = std::max(reciprocal_error, units(reciprocal(value), 1.0 / x));
+				}
+
+				for (std::int32_t bits = -(1 << 22); bits < (1 << 22); bits += 997) {
+					Fixed16x16 angle(FROM_BITS, bits);
+					double x = double(angle);
+
+					sin_error = std::max(sin_error, units(sin(angle), std::sin(x)));
+					cos_error = std::max(cos_error, units(cos(angle), std::cos(x)));
+				}
+
+				examiner << "sqrt: " << sqrt_error << " reciprocal: " << reciprocal_error << " sin: " << sin_error << " cos: " << cos_error << " units" << std::endl;
+
+				examiner.expect(sqrt_error <= 0.5).to(be_true);
+				examiner.expect(reciprocal_error <= 0.5).to(be_true);
+				examiner.expect(sin_error <= 1.0).to(be_true);
+				examiner.expect(cos_error <= 1.0).to(be_true);
+
+				Fixed8x24 angle = 0.5;
+				examiner.expect(units(sin(angle), std::sin(0.5)) <= 1.0).to(be_true);
+				examiner.expect(units(sqrt(angle), std::sqrt(0.5)) <= 0.5).to(be_true);
+			}
+		},
+
+		{"it can be used in vectors, matrices and quaternions",
+			[](UnitTest::Examiner & examiner) {
+				typedef Fixed16x16 F;
+
+				Vector<3, F> a = {F(3), F(0), F(4)};
+
+				examiner.expect(a.length().equivalent(5)).to(be_true);
+				examiner.expect(a.normalize().equivalent({F(0.6), F(0), F(0.8)})).to(be_true);
+				examiner.expect(a.dot(a).equivalent(25)).to(be_true);
+
+				Matrix<4, 4, F> m(IDENTITY);
+				m.at(0, 3) = 10;
+
+				Vector<4, F> p = m * Vector<4, F>{F(1), F(2), F(3), F(1)};
+				examiner.expect(p.equivalent({F(11), F(2), F(3), F(1)})).to(be_true);
+
+				Quaternion<F> q(Radians<F>(R90), Vector<3, F>{F(0), F(0), F(1)});
+				auto r = q * Vector<3, F>{F(1), F(0), F(0)};
+
+				examiner << "Rotated: " << r << std::endl;
+				examiner.expect(r.equivalent({F(0), F(1), F(0)})).to(be_true);
+
+				auto s = (q * q) * Vector<3, F>{F(1), F(0), F(0)};
+				examiner.expect(s.equivalent({F(-1), F(0), F(0)})).to(be_true);
+			}
+		},
+
+		{"array kernels match the scalar operators",
+			[](UnitTest::Examiner & examiner) {
+				std::minstd_rand random(17);
+				std::uniform_int_distribution<std::int32_t> large(std::numeric_limits<std::int32_t>::min(), std::numeric_limits<std::int32_t>::max()), small(-(1 << 20), 1 << 20);
+
+				const std::size_t COUNT = 1027;
+				std::vector<Fixed16x16> a(COUNT), b(COUNT), result(COUNT);
+				std::vector<Wrapping16x16> c(COUNT), d(COUNT), wrapped(COUNT);
+
+				for (std::size_t i = 0; i < COUNT; i += 1) {
+					// A mix of values which overflow and values which don't:
+					auto & distribution = (i % 3 == 0) ? large : small;
+
+					a[i].bits = c[i].bits = distribution(random);
+					b[i].bits = d[i].bits = distribution(random);
+				}
+
+				std::size_t mismatches = 0;
+
+				add(result.data(), a.data(), b.data(), COUNT);
+				add(wrapped.data(), c.data(), d.data(), COUNT);
+
+				for (std::size_t i = 0; i < COUNT; i += 1)
+					mismatches += (result[i] != a[i] + b[i]) + (wrapped[i] != c[i] + d[i]);
+
+				subtract(result.data(), a.data(), b.data(), COUNT);
+				subtract(wrapped.data(), c.data(), d.data(), COUNT);
+
+				for (std::size_t i = 0; i < COUNT; i += 1)
+					mismatches += (result[i] != a[i] - b[i]) + (wrapped[i] != c[i] - d[i]);
+
+				multiply(result.data(), a.data(), b.data(), COUNT);
+				multiply(wrapped.data(), c.data(), d.data(), COUNT);
+
+				for (std::size_t i = 0; i < COUNT; i += 1)
+					mismatches += (result[i] != a[i] * b[i]) + (wrapped[i] != c[i] * d[i]);
+
+				examiner.expect(mismatches) == 0;
+			}
+		},
+	};
+}
@@ -12,6 +12,9 @@
 #include <Numerics/Number.hpp>
 #include <Numerics/Radians.hpp>
 
+#include <random>
+#include <vector>
+
 namespace Numerics
 {
 	using namespace UnitTest::Expectations;
@@ -97,5 +100,79 @@ namespace Numerics
 				examiner.expect(R90.cos()).to(be_equivalent(0.0));
 			}
 		},
+
+		{"it measures the distance in units in the last place",
+			[](UnitTest::Examiner & examiner) {
+				examiner.expect(ulp_distance(1.0f, 1.0f)) == 0u;
+				examiner.expect(ulp_distance(1.0f, std::nextafter(1.0f, 2.0f))) == 1u;
+				examiner.expect(ulp_distance(0.0f, -0.0f)) == 0u;
+				examiner.expect(ulp_distance(-std::numeric_limits<float>::denorm_min(), std::numeric_limits<float>::denorm_min())) == 2u;
+				examiner.expect(ulp_distance(-std::numeric_limits<float>::max(), std::numeric_limits<float>::max())) == 0xFEFFFFFEu;
+				examiner.expect(ulp_distance(1.0, std::numeric_limits<double>::quiet_NaN())) == std::numeric_limits<std::uint64_t>::max();
+
+				examiner.expect(equivalent(1.0f, NAN)) == false;
+				examiner.expect(equivalent(NAN, NAN)) == false;
+			}
+		},
+
+		{"arrays can be compared",
+			[](UnitTest::Examiner & examiner) {
+				std::minstd_rand random(3);
+				std::uniform_real_distribution<float> uniform(-100, 100);
+
+				std::vector<float> a(1003), b(1003);
+
+				for (std::size_t i = 0; i < a.size(); i += 1) {
+					a[i] = uniform(random);
+					b[i] = std::nextafter(std::nextafter(a[i], 200.0f), 200.0f);
+				}
+
+				auto comparison = equivalent(a.data(), b.data(), a.size());
+
+				examiner.expect(comparison.mismatches) == 0;
+				examiner.expect(comparison.first_mismatch) == a.size();
+				examiner.expect(comparison.maximum_distance) == 2;
+				examiner.expect(ulp_distance(a.data(), b.data(), a.size())) == 2u;
+
+				// Mismatches in the vectorized part and the remainder:
+				b[17] = a[17] * 1.01f;
+				b[1001] = NAN;
+
+				comparison = equivalent(a.data(), b.data(), a.size());
+
+				examiner.expect(comparison.mismatches) == 2;
+				examiner.expect(comparison.first_mismatch) == 17;
+				examiner.expect(comparison.maximum_distance) == std::numeric_limits<std::uint32_t>::max();
+
+				// Every pair must agree with the scalar comparison:
+				for (std::size_t i = 0; i < a.size(); i += 1) {
+					b[i] = (i % 3 == 0) ? -a[i] : a[i] + uniform(random) * 1e-6f;
+
+					if (i % 7 == 0) a[i] *= 1e-3f;
+				}
+
+				comparison = equivalent(a.data(), b.data(), a.size());
+
+				std::size_t mismatches = 0, first_mismatch = a.size();
+
+				for (std::size_t i = 0; i < a.size(); i += 1) {
+					if (!equivalent(a[i], b[i])) {
+						if (mismatches == 0) first_mismatch = i;
+						mismatches += 1;
+					}
+				}
+
+				examiner.expect(comparison.mismatches) == mismatches;
+				examiner.expect(comparison.first_mismatch) == first_mismatch;
+
+				std::vector<double> c = {1, 2, 3}, d = {1, 2, 3.1};
+
+				comparison = equivalent(c.data(), d.data(), c.size());
+
+				examiner.expect(comparison.mismatches) == 1;
+				examiner.expect(comparison.first_mismatch) == 2;
+				examiner.expect(ulp_distance(c.data(), d.data(), 2)) == 0u;
+			}
+		},
 	};
 }
@@ -0,0 +1,149 @@
+//
+//  Test.Grid.cpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Numerics/Grid.hpp>
+
+#include <vector>
+
+namespace Numerics
+{
+	using namespace UnitTest::Expectations;
+
+	UnitTest::Suite GridTestSuite {
+		"Numerics::Grid",
+
+		{"ranges visit coordinates in the same order as distribute",
+			[](UnitTest::Examiner & examiner) {
+				Vector<3, std::size_t> size = {4, 3, 5};
+				Vector<3, float> extent = {4, 3, 5};
+
+				std::size_t index = 0, errors = 0;
+
+				for (const auto & coordinate : Range<3>(size)) {
+					if (Vector<3, float>(coordinate) != extent.distribute(index)) errors += 1;
+					if (extent.index(coordinate) != index) errors += 1;
+
+					index += 1;
+				}
+
+				examiner.expect(index) == 60;
+				examiner.expect(errors) == 0;
+
+				// A range with an origin:
+				std::vector<Vector<2, std::size_t>> coordinates;
+				for (const auto & coordinate : Range<2>({1, 5}, {2, 2})) coordinates.push_back(coordinate);
+
+				examiner.check(coordinates == std::vector<Vector<2, std::size_t>>{{1, 5}, {2, 5}, {1, 6}, {2, 6}});
+
+				// Empty ranges have no coordinates:
+				examiner.check(Range<3>({4, 0, 2}).begin() == Range<3>({4, 0, 2}).end());
+				examiner.check(Range<1>(Vector<1, std::size_t>(ZERO)).empty());
+			}
+		},
+
+		{"grids have precomputed and padded strides",
+			[](UnitTest::Examiner & examiner) {
+				Grid<3, float> grid({5, 3, 2}, 8);
+
+				examiner.check(grid.strides() == Vector<3, std::size_t>{1, 8, 24});
+				examiner.expect(grid.count()) == 30;
+				examiner.expect(grid.offset({4, 2, 1})) == 4 + 16 + 24;
+
+				// Every row starts on an aligned boundary:
+				examiner.expect(reinterpret_cast<std::uintptr_t>(&grid[{0, 1, 1}]) % (8 * sizeof(float))) == 0;
+
+				std::size_t index = 0, errors = 0;
+
+				for (const auto & coordinate : grid.view().coordinates())
+					grid[coordinate] = index++;
+
+				// The iterator tracks the same offsets, without the padding:
+				index = 0;
+
+				grid.view().each([&](const Vector<3, std::size_t> & coordinate, float & value) {
+					if (value != index || &value != &grid[coordinate]) errors += 1;
+					index += 1;
+				});
+
+				examiner.expect(index) == 30;
+				examiner.expect(errors) == 0;
+
+				const auto & constant = grid;
+				GridView<3, const float> view = constant.view();
+
+				examiner.expect(view[{2, 1, 1}]) == 2 + 5 + 15;
+				examiner.expect(std::distance(view.begin(), view.end())) == 30;
+			}
+		},
+
+		{"views traverse sub-regions and blocks",
+			[](UnitTest::Examiner & examiner) {
+				Grid<2, float> image(Vector<2, std::size_t>{10, 7});
+				image.fill(0);
+
+				auto region = image.view({2, 3}, {4, 2});
+				region.fill(1);
+
+				float total = 0;
+				for (float value : image.view()) total += value;
+
+				examiner.expect(total) == 8;
+				examiner.expect(image[{2, 3}]) == 1;
+				examiner.expect(image[{5, 4}]) == 1;
+				examiner.expect(image[{6, 4}]) == 0;
+
+				// Blocks cover every value exactly once, with smaller blocks at the edges:
+				auto view = image.view();
+				Vector<2, std::size_t> block_size = {4, 4};
+
+				std::size_t blocks = 0;
+
+				for (const auto & index : view.blocks(block_size)) {
+					for (auto & value : view.block(index, block_size))
+						value += 1;
+
+					blocks += 1;
+				}
+
+				examiner.expect(blocks) == 6;
+				examiner.check(view.block({2, 1}, block_size).size() == Vector<2, std::size_t>{2, 3});
+
+				std::size_t errors = 0;
+
+				view.each([&](const Vector<2, std::size_t> & coordinate, float value) {
+					float expected = (coordinate[0] >= 2 && coordinate[0] < 6 && coordinate[1] >= 3 && coordinate[1] < 5) ? 2 : 1;
+					if (value != expected) errors += 1;
+				});
+
+				examiner.expect(errors) == 0;
+			}
+		},
+
+		{"views can have arbitrary strides",
+			[](UnitTest::Examiner & examiner) {
+				float data[12];
+				for (std::size_t i = 0; i < 12; i += 1) data[i] = i;
+
+				// A transposed view of a 4x3 row-major array:
+				GridView<2, float> transposed(data, {3, 4}, {4, 1});
+
+				std::size_t count = 0, errors = 0;
+
+				transposed.each([&](const Vector<2, std::size_t> & coordinate, float value) {
+					if (value != coordinate[0] * 4 + coordinate[1]) errors += 1;
+					count += 1;
+				});
+
+				examiner.expect(count) == 12;
+				examiner.expect(errors) == 0;
+			}
+		},
+	};
+}
@@ -0,0 +1,155 @@
+//
+//  Test.Half.cpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Numerics/Half.hpp>
+#include <Numerics/Vector.hpp>
+
+#include <random>
+#include <vector>
+
+namespace Numerics
+{
+	using namespace UnitTest::Expectations;
+
+	UnitTest::Suite HalfTestSuite {
+		"Numerics::Half",
+
+		{"every half value converts to float and back exactly",
+			[](UnitTest::Examiner & examiner) {
+				std::size_t mismatches = 0;
+
+				for (std::uint32_t bits = 0; bits <= 0xFFFF; bits += 1) {
+					Half value(FROM_BITS, bits);
+					float f = value;
+
+					if (std::isnan(f)) {
+						if ((bits & 0x7C00) != 0x7C00 || (bits & 0x03FF) == 0) mismatches += 1;
+					} else if (Half(f).bits != bits) {
+						mismatches += 1;
+					}
+				}
+
+				examiner.expect(mismatches) == 0;
+			}
+		},
+
+		{"it rounds to nearest even",
+			[](UnitTest::Examiner & examiner) {
+				// Halfway between 1 and the next half is rounded down to the even mantissa, and the next halfway point is rounded up:
+				examiner.expect(float(Half(1.0f + 0.00048828125f))) == 1.0f;
+				examiner.expect(float(Half(1.0f + 3 * 0.00048828125f))) == 1.0f + 4 * 0.00048828125f;
+
+				examiner.expect(float(Half(65504.0f))) == 65504.0f;
+				examiner.expect(float(Half(65519.0f))) == 65504.0f;
+				examiner.expect(Half(65520.0f).bits) == 0x7C00;
+				examiner.expect(Half(-1e10f).bits) == 0xFC00;
+
+				// The smallest subnormal, and half of it which rounds to zero:
+				examiner.expect(Half(5.9604644775390625e-08f).bits) == 0x0001;
+				examiner.expect(Half(2.98023223876953125e-08f).bits) == 0x0000;
+				examiner.expect(Half(-0.0f).bits) == 0x8000;
+
+				examiner.expect(std::isnan(float(Half(NAN)))).to(be_true);
+				examiner.expect(float(std::numeric_limits<Half>::max())) == 65504.0f;
+				examiner.expect(float(std::numeric_limits<Half>::epsilon())) == 0.0009765625f;
+			}
+		},
+
+		{"bfloat16 rounds to nearest even",
+			[](UnitTest::Examiner & examiner) {
+				examiner.expect(float(BFloat16(1.0f))) == 1.0f;
+				examiner.expect(float(BFloat16(1.0f + 0.00390625f))) == 1.0f;
+				examiner.expect(float(BFloat16(1.0f + 3 * 0.00390625f))) == 1.0f + 4 * 0.00390625f;
+				examiner.expect(float(std::numeric_limits<BFloat16>::max())) == 3.38953139e38f;
+				examiner.expect(std::isnan(float(BFloat16(NAN)))).to(be_true);
+				examiner.expect(float(std::numeric_limits<BFloat16>::epsilon())) == 0.0078125f;
+			}
+		},
+
+		{"bulk conversion matches scalar conversion",
+			[](UnitTest::Examiner & examiner) {
+				std::minstd_rand random(13);
+				std::uniform_real_distribution<float> exponent(-30, 18);
+				std::bernoulli_distribution negative(0.5);
+
+				std::vector<float> values;
+
+				for (std::size_t i = 0; i < 1021; i += 1)
+					values.push_back(std::pow(2.0f, exponent(random)) * (negative(random) ? -1 : 1));
+
+				// Rounding boundaries and special values:
+				for (float value : {0.0f, -0.0f, 1.00048828125f, 1.00146484375f, 65519.0f, 65520.0f, 6.1035156e-05f, INFINITY, -INFINITY})
+					values.push_back(value);
+
+				std::vector<Half> halves(values.size());
+				std::vector<BFloat16> bfloats(values.size());
+				std::vector<float> result(values.size());
+
+				convert(halves.data(), values.data(), values.size());
+				convert(bfloats.data(), values.data(), values.size());
+
+				std::size_t half_mismatches = 0, bfloat_mismatches = 0;
+
+				for (std::size_t i = 0; i < values.size(); i += 1) {
+					if (halves[i].bits != Half(values[i]).bits) half_mismatches += 1;
+					if (bfloats[i].bits != BFloat16(values[i]).bits) bfloat_mismatches += 1;
+				}
+
+				examiner.expect(half_mismatches) == 0;
+				examiner.expect(bfloat_mismatches) == 0;
+
+				half_mismatches = bfloat_mismatches = 0;
+
+				convert(result.data(), halves.data(), halves.size());
+
+				for (std::size_t i = 0; i < values.size(); i += 1)
+					if (result[i] != float(halves[i])) half_mismatches += 1;
+
+				convert(result.data(), bfloats.data(), bfloats.size());
+
+				for (std::size_t i = 0; i < values.size(); i += 1)
+					if (result[i] != float(bfloats[i])) bfloat_mismatches += 1;
+
+				examiner.expect(half_mismatches) == 0;
+				examiner.expect(bfloat_mismatches) == 0;
+			}
+		},
+
+		{"it can be used in vectors",
+			[](UnitTest::Examiner & examiner) {
+				Vector<3, Half> a = {1.0f, 2.0f, 2.0f}, b(ZERO);
+
+				b += a;
+				b *= 0.5f;
+
+				examiner.expect(sizeof(a)) == 6;
+				examiner.expect(float(a.length())) == 3.0f;
+				examiner.expect(b.equivalent(Vector<3, Half>{0.5f, 1.0f, 1.0f})).to(be_true);
+
+				Vector<3, float> c = a.normalize();
+				examiner.expect(Vector<3, Half>(c).equivalent(Vector<3, Half>{1.0f / 3.0f, 2.0f / 3.0f, 2.0f / 3.0f})).to(be_true);
+
+				Vector<2, BFloat16> d = {3.0f, 4.0f};
+				examiner.expect(float(d.length())) == 5.0f;
+			}
+		},
+
+		{"equivalence allows for rounding",
+			[](UnitTest::Examiner & examiner) {
+				examiner.expect(equivalent(Half(0.1f), Half(0.1001f))).to(be_true);
+				examiner.expect(equivalent(Half(0.1f), Half(0.11f))).to(be_false);
+				examiner.expect(equivalent(Half(1000.0f), Half(1000.5f))).to(be_true);
+				examiner.expect(equivalent(Half(1000.0f), Half(1010.0f))).to(be_false);
+				examiner.expect(equivalent(BFloat16(100.0f), BFloat16(100.5f))).to(be_true);
+				examiner.expect(equivalent(BFloat16(100.0f), BFloat16(110.0f))).to(be_false);
+			}
+		},
+	};
+}
@@ -66,6 +66,57 @@ namespace Numerics
 			}
 		},
 
+		{"it can transpose 4x4 matrices",
+			[](UnitTest::Examiner & examiner) {
+				Matrix<4, 4, float> a;
+				Matrix<4, 4, double> b;
+				load_test_pattern(a);
+				load_test_pattern(b);
+
+				auto at = a.transpose();
+				auto bt = b.transpose();
+
+				bool correct = true;
+				for (std::size_t r = 0; r < 4; r += 1)
+					for (std::size_t c = 0; c < 4; c += 1)
+						correct = correct && at.at(c, r) == a.at(r, c) && bt.at(c, r) == b.at(r, c);
+
+				examiner.check(correct);
+
+				a.transpose_in_place();
+				b.transpose_in_place();
+
+				examiner << "Transposing in place gives the same result." << std::endl;
+				examiner.check(a == at);
+				examiner.check(b == bt);
+
+				Matrix<3, 3, float> c;
+				load_test_pattern(c);
+				auto ct = c.transpose();
+				c.transpose_in_place();
+				examiner.check(c == ct);
+			}
+		},
+
+		{"it can transpose large matrices",
+			[](UnitTest::Examiner & examiner) {
+				const std::size_t ROWS = 67, COLUMNS = 45;
+				std::vector<double> source(ROWS * COLUMNS), result(ROWS * COLUMNS);
+
+				for (std::size_t i = 0; i < source.size(); i += 1)
+					source[i] = i;
+
+				transpose(ROWS, COLUMNS, source.data(), ROWS, result.data(), COLUMNS);
+
+				bool correct = true;
+				for (std::size_t c = 0; c < COLUMNS; c += 1)
+					for (std::size_t r = 0; r < ROWS; r += 1)
+						correct = correct && result[r * COLUMNS + c] == source[c * ROWS + r];
+
+				examiner.check(correct);
+			}
+		},
+
 		{"Transforms",
 			[](UnitTest::Examiner & examiner) {
 				Mat44 transform = Transforms::translate(Vec4(5, 5, 5, 1));
@@ -204,6 +255,34 @@ namespace Numerics
 			}
 		},
 
+		{"it can transform arrays of points",
+			[](UnitTest::Examiner & examiner) {
+				Matrix<4, 4, double> transform = Transforms::rotate<X>(R90) << Transforms::translate(vector(1.0, 2.0, 3.0));
+
+				Vector<3, double> points[] = {{0.0, 0.0, 0.0}, {1.0, 2.0, 3.0}, {-4.0, 5.0, 0.5}}, result[3];
+				multiply(result, transform, points, 3);
+
+				for (std::size_t i = 0; i < 3; i += 1)
+					examiner.check(result[i].equivalent(transform * points[i]));
+
+				Mat44 single = Transforms::translate(Vec3(1, 2, 3));
+				Vec3 point(1, 1, 1);
+				multiply(&point, single, &point, 1);
+
+				examiner.check_equal(point, Vec3(2, 3, 4));
+
+				examiner << "Vectors can be multiplied in place." << std::endl;
+				Matrix<3, 3, double> identity = IDENTITY, scale = Transforms::scale(vector(2.0, 3.0, 4.0));
+				Vector<3, double> vectors[] = {{1, 2, 3}, {4, 5, 6}};
+
+				multiply(vectors, identity, vectors, 2);
+				examiner.check(vectors[0] == vector(1.0, 2.0, 3.0) && vectors[1] == vector(4.0, 5.0, 6.0));
+
+				multiply(vectors, scale, vectors, 2);
+				examiner.check(vectors[0] == vector(2.0, 6.0, 12.0) && vectors[1] == vector(8.0, 15.0, 24.0));
+			}
+		},
+
 		{"Inverse",
 			[](UnitTest::Examiner & examiner) {
 				Mat44 m1 = Transforms::rotate<X>(R90);
@@ -0,0 +1,127 @@
+//
+//  Test.Parallel.cpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Numerics/Parallel/ThreadPool.hpp>
+#include <Numerics/Parallel/Kernels.hpp>
+
+#include <stdexcept>
+
+namespace Numerics
+{
+	namespace Parallel
+	{
+		UnitTest::Suite ParallelTestSuite {
+			"Numerics::Parallel",
+
+			{"it runs every task exactly once",
+				[](UnitTest::Examiner & examiner) {
+					ThreadPool pool(3);
+					std::vector<std::atomic<int>> counts(1000);
+
+					for (auto & count : counts) count = 0;
+
+					pool.run(counts.size(), [&](std::size_t i) {counts[i] += 1;});
+
+					examiner.check(std::all_of(counts.begin(), counts.end(), [](const std::atomic<int> & count) {return count == 1;}));
+				}
+			},
+
+			{"it can run nested batches",
+				[](UnitTest::Examiner & examiner) {
+					ThreadPool pool(2);
+					std::atomic<int> total(0);
+
+					pool.run(8, [&](std::size_t) {
+						pool.run(8, [&](std::size_t) {total += 1;});
+					});
+
+					examiner.check_equal(total.load(), 64);
+				}
+			},
+
+			{"it rethrows exceptions from tasks",
+				[](UnitTest::Examiner & examiner) {
+					ThreadPool pool(2);
+					bool thrown = false;
+
+					try {
+						pool.run(16, [&](std::size_t i) {
+							if (i == 7) throw std::runtime_error("task failed");
+						});
+					} catch (std::runtime_error &) {
+						thrown = true;
+					}
+
+					examiner.check(thrown);
+				}
+			},
+
+			{"it splits ranges by grain",
+				[](UnitTest::Examiner & examiner) {
+					ThreadPool pool(2);
+					std::atomic<std::size_t> chunks(0), total(0);
+
+					parallel_for(0, 1000, 64, [&](std::size_t begin, std::size_t end) {
+						chunks += 1;
+						total += end - begin;
+					}, pool);
+
+					examiner.check_equal(chunks.load(), 16);
+					examiner.check_equal(total.load(), 1000);
+				}
+			},
+
+			{"it can multiply large matrices",
+				[](UnitTest::Examiner & examiner) {
+					ThreadPool pool(3);
+					DynamicMatrix<float> a(150, 70), b(70, 203);
+
+					for (std::size_t i = 0; i < a.size(); i += 1) a[i] = float((i * 7) % 11) - 5;
+					for (std::size_t i = 0; i < b.size(); i += 1) b[i] = float((i * 5) % 13) - 6;
+
+					DynamicMatrix<float> c(150, 203);
+					multiply(c, a, b, 16, pool);
+
+					examiner.check(c == a * b);
+				}
+			},
+
+			{"it can transform points",
+				[](UnitTest::Examiner & examiner) {
+					ThreadPool pool(3);
+					Mat44 transform = Transforms::translate(Vec3(1, 2, 3));
+
+					std::vector<Vec3> points(10000, Vec3(1, 1, 1)), result(points.size());
+					multiply(result.data(), transform, points.data(), points.size(), 100, pool);
+
+					examiner.check(std::all_of(result.begin(), result.end(), [](const Vec3 & point) {return point == Vec3(2, 3, 4);}));
+				}
+			},
+
+			{"it computes the same dot product with any executor",
+				[](UnitTest::Examiner & examiner) {
+					ThreadPool pool(3);
+					SerialExecutor serial;
+					DynamicVector<float> x(100000), y(100000);
+
+					for (std::size_t i = 0; i < x.size(); i += 1) {
+						x[i] = float(i % 17) * 0.25f;
+						y[i] = float(i % 5) - 2.0f;
+					}
+
+					examiner.check_equal(dot(x, y, 1000, pool), dot(x, y, 1000, serial));
+
+					axpy(2.0f, x, y, 1000, pool);
+					examiner.check_equal(y[17], 2.0f * x[17] + float(17 % 5) - 2.0f);
+				}
+			},
+		};
+	}
+}
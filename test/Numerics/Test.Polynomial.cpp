@@ -0,0 +1,127 @@
+//
+//  Test.Polynomial.cpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Numerics/Polynomial.hpp>
+#include <Numerics/Interpolate.hpp>
+#include <Numerics/Vector/IO.hpp>
+
+#include <random>
+#include <vector>
+
+namespace Numerics
+{
+	using namespace UnitTest::Expectations;
+
+	UnitTest::Suite PolynomialTestSuite {
+		"Numerics::Polynomial",
+
+		{"it converts interpolation bases to the power basis",
+			[](UnitTest::Examiner & examiner) {
+				auto cubic = Polynomial<4, double, double>::cubic(1, 4, -2, 3);
+				auto hermite = Polynomial<4, double, double>::hermite(1, 4, -2, 3);
+				auto linear = Polynomial<2, double, double>::linear(1, 4);
+
+				for (double t = 0; t <= 1; t += 0.125) {
+					examiner.expect(equivalent(cubic(t), Interpolate::cubic(t, 1.0, 4.0, -2.0, 3.0))).to(be_true);
+					examiner.expect(equivalent(hermite(t), Interpolate::hermite(t, 1.0, 4.0, -2.0, 3.0))).to(be_true);
+					examiner.expect(equivalent(linear(t), Interpolate::linear(t, 1.0, 4.0))).to(be_true);
+				}
+
+				auto bezier = Polynomial<4, double, double>::bezier(0, 1, 1, 0);
+				examiner.expect(bezier(0)) == 0;
+				examiner.expect(bezier(0.5)) == 0.75;
+				examiner.expect(bezier(1)) == 0;
+			}
+		},
+
+		{"it computes derivatives",
+			[](UnitTest::Examiner & examiner) {
+				// 1 + 2t + 3t^2 + 4t^3:
+				Polynomial<4, double, double> polynomial = {{1, 2, 3, 4}};
+				auto derivative = polynomial.derivative();
+
+				examiner.expect(derivative.coefficients[0]) == 2;
+				examiner.expect(derivative.coefficients[1]) == 6;
+				examiner.expect(derivative.coefficients[2]) == 12;
+
+				auto second = polynomial.derivative().derivative();
+				examiner.expect(second(1)) == 30;
+			}
+		},
+
+		{"uniform evaluation matches Horner's method",
+			[](UnitTest::Examiner & examiner) {
+				Polynomial<4, double, double> polynomial = {{0.5, -3, 2, 1.25}};
+				Polynomial<6, double, double> quintic = {{1, -1, 0.5, 2, -0.25, 0.125}};
+
+				const std::size_t COUNT = 1000;
+				std::vector<double> cubic_samples(COUNT), quintic_samples(COUNT);
+
+				polynomial.evaluate_uniform(COUNT, -1, 0.002, cubic_samples.data());
+				quintic.evaluate_uniform(COUNT, -1, 0.002, quintic_samples.data());
+
+				double cubic_error = 0, quintic_error = 0;
+
+				for (std::size_t i = 0; i < COUNT; i += 1) {
+					double t = -1 + 0.002 * i;
+
+					cubic_error = std::max(cubic_error, std::abs(cubic_samples[i] - polynomial(t)));
+					quintic_error = std::max(quintic_error, std::abs(quintic_samples[i] - quintic(t)));
+				}
+
+				examiner << "cubic: " << cubic_error << " quintic: " << quintic_error << std::endl;
+
+				examiner.expect(cubic_error < 1e-10).to(be_true);
+				examiner.expect(quintic_error < 1e-9).to(be_true);
+
+				// Vector coefficients in single precision:
+				auto curve = Polynomial<4, Vector<3, float>, float>::bezier({0, 0, 0}, {1, 2, 0}, {3, 2, 1}, {4, 0, 0});
+				std::vector<Vector<3, float>> points(101);
+
+				curve.evaluate_uniform(points.size(), 0, 0.01f, points.data());
+
+				float vector_error = 0;
+
+				for (std::size_t i = 0; i < points.size(); i += 1)
+					vector_error = std::max(vector_error, (points[i] - curve(i * 0.01f)).length().value);
+
+				examiner.expect(vector_error < 1e-5f).to(be_true);
+			}
+		},
+
+		{"batch evaluation matches scalar evaluation",
+			[](UnitTest::Examiner & examiner) {
+				std::minstd_rand random(11);
+				std::uniform_real_distribution<float> uniform(-2, 2);
+
+				std::vector<float> parameters(1027);
+				for (auto & t : parameters) t = uniform(random);
+
+				Polynomial<4, float, float> polynomial = {{0.5f, -3, 2, 1.25f}};
+				auto curve = Polynomial<4, Vector<3, float>, float>::hermite({0, 0, 0}, {1, 0, 0}, {2, 1, 0}, {0, 1, 1});
+
+				std::vector<float> values(parameters.size());
+				std::vector<Vector<3, float>> points(parameters.size());
+
+				polynomial.evaluate(parameters.size(), parameters.data(), values.data());
+				curve.evaluate(parameters.size(), parameters.data(), points.data());
+
+				std::size_t mismatches = 0;
+
+				for (std::size_t i = 0; i < parameters.size(); i += 1) {
+					if (!equivalent(values[i], polynomial(parameters[i]))) mismatches += 1;
+					if (!points[i].equivalent(curve(parameters[i]))) mismatches += 1;
+				}
+
+				examiner.expect(mismatches) == 0;
+			}
+		},
+	};
+}
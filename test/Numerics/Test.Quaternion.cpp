@@ -11,6 +11,9 @@
 #include <Numerics/Quaternion.hpp>
 #include <Numerics/Matrix.hpp>
 #include <Numerics/Transforms.hpp>
+#include <Numerics/Vector/IO.hpp>
+
+#include <random>
 
 namespace Numerics
 {
@@ -119,5 +122,236 @@ namespace Numerics
 				examiner.expect(q3).to(be_equivalent(Quaternion<>(IDENTITY)));
 			}
 		},
+
+		{"it can be extracted from a rotation matrix",
+			[](UnitTest::Examiner & examiner) {
+				// Include rotations near 180 degrees, where w is close to zero:
+				std::vector<Quaternion<double>> rotations = {
+					Quaternion<double>(IDENTITY),
+					{90_deg, Vector<3, double>(1, 0, 0)},
+					{180_deg, Vector<3, double>(1, 0, 0)},
+					{180_deg, Vector<3, double>(0, 1, 0)},
+					{179.9_deg, Vector<3, double>(0, 0, 1)},
+					{123_deg, Vector<3, double>(1, -2, 3).normalize()},
+				};
+
+				for (auto & q : rotations) {
+					Matrix<4, 4, double> m = q;
+					Quaternion<double> r(m);
+
+					examiner << "Extracted rotation is " << r << " for " << q << std::endl;
+					examiner.check(r.equivalent(q) || r.equivalent(-q));
+				}
+			}
+		},
+
+		{"it can convert arrays of matrices",
+			[](UnitTest::Examiner & examiner) {
+				std::vector<Matrix<4, 4, float>> m44;
+				std::vector<Matrix<3, 3, float>> m33;
+
+				for (std::size_t i = 0; i < 11; i += 1) {
+					Quaternion<float> q(Radians<float>(i * 0.6f), Vec3(1.0f, i * 0.5f, -2.0f).normalize());
+
+					m44.push_back(q);
+					m33.push_back(q);
+				}
+
+				std::vector<Quaternion<float>> a(m44.size()), b(m33.size());
+				convert(a.data(), m44.data(), m44.size());
+				convert(b.data(), m33.data(), m33.size());
+
+				bool correct = true;
+				for (std::size_t i = 0; i < a.size(); i += 1)
+					correct = correct && a[i].equivalent(Quaternion<float>(m44[i])) && b[i].equivalent(Quaternion<float>(m33[i]));
+
+				examiner.check(correct);
+			}
+		},
+
+		{"it can multiply arrays of quaternions",
+			[](UnitTest::Examiner & examiner) {
+				std::vector<Quaternion<float>> a, b;
+				std::vector<Quaternion<double>> c, d;
+
+				for (std::size_t i = 0; i < 7; i += 1) {
+					a.push_back({Radians<float>(i * 0.7f), Vec3(1.0f, -0.5f * i, 2.0f).normalize()});
+					b.push_back({Radians<float>(1.0f - i * 0.3f), Vec3(0.5f * i, 1.0f, -1.0f).normalize()});
+					c.push_back({Radians<double>(i * 0.7), Vector<3, double>(1.0, -0.5 * i, 2.0).normalize()});
+					d.push_back({Radians<double>(1.0 - i * 0.3), Vector<3, double>(0.5 * i, 1.0, -1.0).normalize()});
+				}
+
+				std::vector<Quaternion<float>> ab(a.size()), ac(a.size());
+				std::vector<Quaternion<double>> cd(c.size()), cc(c.size());
+
+				multiply(ab.data(), a.data(), b.data(), a.size());
+				multiply(cd.data(), c.data(), d.data(), c.size());
+				conjugate(ac.data(), a.data(), a.size());
+				conjugate(cc.data(), c.data(), c.size());
+
+				bool correct = true;
+				for (std::size_t i = 0; i < a.size(); i += 1) {
+					// Rotating by the product is the same as rotating by each in turn:
+					Vec3 p(1, 2, 3);
+					correct = correct && (ab[i] * p).equivalent(a[i] * (b[i] * p));
+					correct = correct && (cd[i] * Vector<3, double>(1, 2, 3)).equivalent(c[i] * (d[i] * Vector<3, double>(1, 2, 3)));
+
+					correct = correct && (ac[i] * a[i]).equivalent(Quaternion<float>(IDENTITY));
+					correct = correct && (cc[i] * c[i]).equivalent(Quaternion<double>(IDENTITY));
+				}
+
+				examiner.check(correct);
+			}
+		},
+
+		{"it can rotate arrays of points",
+			[](UnitTest::Examiner & examiner) {
+				std::vector<Quaternion<float>> rotations;
+				std::vector<Vec3> points;
+
+				for (std::size_t i = 0; i < 11; i += 1) {
+					rotations.push_back({Radians<float>(i * 0.4f), Vec3(i * 0.5f, 1.0f, -2.0f).normalize()});
+					points.push_back(Vec3(i, -1.0f, i * 0.25f));
+				}
+
+				std::vector<Vec3> result(points.size());
+				multiply(result.data(), rotations.data(), points.data(), points.size());
+
+				bool correct = true;
+				for (std::size_t i = 0; i < points.size(); i += 1)
+					correct = correct && result[i].equivalent(Matrix<3, 3, float>(rotations[i]) * points[i]);
+
+				examiner.check(correct);
+			}
+		},
+
+		{"it can convert arrays of quaternions to matrices",
+			[](UnitTest::Examiner & examiner) {
+				std::vector<Quaternion<float>> rotations;
+
+				for (std::size_t i = 0; i < 9; i += 1)
+					rotations.push_back({Radians<float>(i * 0.8f), Vec3(-1.0f, 2.0f, i * 0.5f).normalize()});
+
+				std::vector<Matrix<4, 4, float>> m44(rotations.size());
+				std::vector<Matrix<3, 4, float>> m34(rotations.size());
+
+				convert(m44.data(), rotations.data(), rotations.size());
+				convert(m34.data(), rotations.data(), rotations.size());
+
+				bool correct = true;
+				for (std::size_t i = 0; i < rotations.size(); i += 1) {
+					correct = correct && m44[i].equivalent(Matrix<4, 4, float>(rotations[i]));
+					correct = correct && m34[i].equivalent(Matrix<3, 4, float>(rotations[i]));
+				}
+
+				examiner.check(correct);
+			}
+		},
+
+		{"it can interpolate arrays of rotations",
+			[](UnitTest::Examiner & examiner) {
+				const std::size_t COUNT = 1003;
+				std::vector<float> t(COUNT), components[4][4];
+
+				for (auto & array : components)
+					for (auto & values : array)
+						values.resize(COUNT);
+
+				std::minstd_rand random(7);
+				std::uniform_real_distribution<float> uniform(-1, 1);
+
+				for (std::size_t i = 0; i < COUNT; i += 1) {
+					t[i] = (uniform(random) + 1) / 2;
+
+					// Random unit quaternions, some pairs of which have negative dot products:
+					for (std::size_t q = 0; q < 2; q += 1) {
+						Vec4 value = Vec4(uniform(random), uniform(random), uniform(random), uniform(random)).normalize();
+
+						for (std::size_t c = 0; c < 4; c += 1)
+							components[q][c][i] = value[c];
+					}
+				}
+
+				auto arrays = [&](std::size_t q) {
+					return QuaternionArrays<float>{components[q][0].data(), components[q][1].data(), components[q][2].data(), components[q][3].data()};
+				};
+
+				Interpolate::spherical_linear(COUNT, t.data(), arrays(0), arrays(1), arrays(2));
+				Interpolate::fast_spherical_linear(COUNT, t.data(), arrays(0), arrays(1), arrays(3));
+
+				float maximum_error = 0;
+				bool matches = true;
+
+				for (std::size_t i = 0; i < COUNT; i += 1) {
+					Quaternion<float> q0({components[0][0][i], components[0][1][i], components[0][2][i], components[0][3][i]});
+					Quaternion<float> q1({components[1][0][i], components[1][1][i], components[1][2][i], components[1][3][i]});
+					Quaternion<float> exact({components[2][0][i], components[2][1][i], components[2][2][i], components[2][3][i]});
+
+					if (q0.dot(q1) >= 0)
+						matches = matches && exact.equivalent(Interpolate::spherical_linear(t[i], q0, q1));
+
+					for (std::size_t c = 0; c < 4; c += 1)
+						maximum_error = std::max(maximum_error, std::abs(components[3][c][i] - exact[c]));
+				}
+
+				examiner << "Exact interpolation matches spherical_linear." << std::endl;
+				examiner.check(matches);
+
+				examiner << "Fast interpolation is within the documented error bound: " << maximum_error << std::endl;
+				examiner.check(maximum_error < 4e-5f);
+			}
+		},
+
+		{"it can be compressed",
+			[](UnitTest::Examiner & examiner) {
+				std::minstd_rand random(11);
+				std::normal_distribution<float> normal;
+
+				std::vector<Quaternion<float>> rotations = {Quaternion<float>(IDENTITY), Quaternion<float>(Vec4(0, 0, 0, -1)), Quaternion<float>(Vec4(0.5, -0.5, 0.5, -0.5))};
+
+				for (std::size_t i = 0; i < 997; i += 1)
+					rotations.push_back(Vec4(normal(random), normal(random), normal(random), normal(random)).normalize());
+
+				auto maximum_angle = [&](const std::vector<Quaternion<float>> & decoded) {
+					double maximum = 0;
+
+					for (std::size_t i = 0; i < rotations.size(); i += 1) {
+						// The angle between two rotations, 2 acos(|q1.q2|), computed from the chord length for accuracy:
+						Vector<4, double> a = rotations[i], b = decoded[i];
+						if (a.dot(b) < 0) b = -b;
+
+						maximum = std::max(maximum, 4 * std::asin((a - b).length() / 2));
+					}
+
+					return maximum;
+				};
+
+				std::vector<std::uint32_t> packed32(rotations.size());
+				std::vector<UInt48> packed48(rotations.size());
+				std::vector<std::uint64_t> packed64(rotations.size());
+				std::vector<Quaternion<float>> decoded(rotations.size());
+
+				SmallestThree32::encode(packed32.data(), rotations.data(), rotations.size());
+				SmallestThree32::decode(decoded.data(), packed32.data(), packed32.size());
+				examiner << "32-bit encoding error: " << maximum_angle(decoded) << std::endl;
+				examiner.check(maximum_angle(decoded) <= SmallestThree32::maximum_angular_error());
+
+				bool matches = true;
+				for (std::size_t i = 0; i < rotations.size(); i += 1)
+					matches = matches && packed32[i] == SmallestThree32::encode(rotations[i]) && decoded[i].equivalent(SmallestThree32::decode(packed32[i]));
+				examiner << "Bulk encoding matches scalar encoding." << std::endl;
+				examiner.check(matches);
+
+				SmallestThree48::encode(packed48.data(), rotations.data(), rotations.size());
+				SmallestThree48::decode(decoded.data(), packed48.data(), packed48.size());
+				examiner << "48-bit encoding error: " << maximum_angle(decoded) << std::endl;
+				examiner.check(maximum_angle(decoded) <= SmallestThree48::maximum_angular_error());
+
+				SmallestThree64::encode(packed64.data(), rotations.data(), rotations.size());
+				SmallestThree64::decode(decoded.data(), packed64.data(), packed64.size());
+				examiner << "64-bit encoding error: " << maximum_angle(decoded) << std::endl;
+				examiner.check(maximum_angle(decoded) <= SmallestThree64::maximum_angular_error());
+			}
+		},
 	};
 }
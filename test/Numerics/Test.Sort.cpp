@@ -0,0 +1,163 @@
+//
+//  Test.Sort.cpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Numerics/Sort.hpp>
+#include <Numerics/Parallel/Sort.hpp>
+#include <Numerics/Parallel/ThreadPool.hpp>
+#include <Numerics/Vector.hpp>
+#include <Numerics/Matrix.hpp>
+
+#include <random>
+#include <vector>
+
+namespace Numerics
+{
+	using namespace UnitTest::Expectations;
+
+	template <typename KeyT>
+	std::vector<KeyT> random_keys(std::size_t count, KeyT minimum, KeyT maximum)
+	{
+		std::minstd_rand random(count);
+		std::uniform_real_distribution<KeyT> distribution(minimum, maximum);
+
+		std::vector<KeyT> keys(count);
+
+		for (auto & key : keys)
+			key = distribution(random);
+
+		return keys;
+	}
+
+	UnitTest::Suite SortTestSuite {
+		"Numerics::Sort",
+
+		{"it sorts floating point keys",
+			[](UnitTest::Examiner & examiner) {
+				auto keys = random_keys<float>(10007, -1000, 1000);
+
+				// Special values and keys with identical high digits:
+				keys[0] = -0.0f; keys[1] = 0.0f; keys[2] = INFINITY; keys[3] = -INFINITY;
+				keys[4] = std::numeric_limits<float>::denorm_min(); keys[5] = -std::numeric_limits<float>::max();
+				keys[6] = 1.0f; keys[7] = std::nextafter(1.0f, 2.0f);
+
+				auto expected = keys;
+				std::sort(expected.begin(), expected.end());
+
+				radix_sort(keys.data(), keys.size());
+
+				examiner.check(keys == expected);
+
+				auto doubles = random_keys<double>(4099, -1e10, 1e10);
+				auto expected_doubles = doubles;
+				std::sort(expected_doubles.begin(), expected_doubles.end());
+
+				radix_sort(doubles.data(), doubles.size());
+
+				examiner.check(doubles == expected_doubles);
+
+				// Sorted input stays sorted, and empty input is allowed:
+				radix_sort(doubles.data(), doubles.size());
+				examiner.check(doubles == expected_doubles);
+
+				radix_sort(doubles.data(), 0);
+			}
+		},
+
+		{"it sorts integer keys",
+			[](UnitTest::Examiner & examiner) {
+				std::mt19937_64 random(5);
+
+				std::vector<std::uint64_t> keys(3001);
+				for (auto & key : keys) key = random();
+
+				auto expected = keys;
+				std::sort(expected.begin(), expected.end());
+
+				radix_sort(keys.data(), keys.size());
+				examiner.check(keys == expected);
+
+				std::vector<std::uint32_t> small = {5, 3, 0xFFFFFFFF, 0, 3, 1 << 22};
+				radix_sort(small.data(), small.size());
+
+				examiner.check(small == std::vector<std::uint32_t>{0, 3, 3, 5, 1 << 22, 0xFFFFFFFF});
+			}
+		},
+
+		{"it sorts values by key",
+			[](UnitTest::Examiner & examiner) {
+				const std::size_t COUNT = 5000;
+
+				// Many duplicate keys, so that stability is checked:
+				std::vector<float> keys(COUNT);
+				std::vector<std::uint32_t> indices(COUNT);
+				std::vector<Vector<3, float>> points(COUNT);
+				std::vector<Matrix<4, 4, float>> transforms(COUNT);
+
+				for (std::size_t i = 0; i < COUNT; i += 1) {
+					keys[i] = float((i * 7919) % 101) - 50;
+					indices[i] = i;
+					points[i] = {keys[i], float(i), 0};
+					transforms[i] = Matrix<4, 4, float>(IDENTITY);
+					transforms[i][12] = keys[i];
+					transforms[i][13] = i;
+				}
+
+				auto point_keys = keys, transform_keys = keys;
+
+				radix_sort(keys.data(), indices.data(), COUNT);
+				radix_sort(point_keys.data(), points.data(), COUNT);
+				radix_sort(transform_keys.data(), transforms.data(), COUNT);
+
+				std::size_t errors = 0;
+
+				for (std::size_t i = 0; i < COUNT; i += 1) {
+					if (points[i][0] != point_keys[i] || transforms[i][12] != transform_keys[i]) errors += 1;
+
+					if (i > 0) {
+						if (keys[i-1] > keys[i]) errors += 1;
+						if (keys[i-1] == keys[i] && indices[i-1] >= indices[i]) errors += 1;
+						if (points[i-1][0] == points[i][0] && points[i-1][1] >= points[i][1]) errors += 1;
+						if (transforms[i-1][12] == transforms[i][12] && transforms[i-1][13] >= transforms[i][13]) errors += 1;
+					}
+				}
+
+				examiner.expect(errors) == 0;
+				examiner.check(point_keys == keys);
+				examiner.check(transform_keys == keys);
+			}
+		},
+
+		{"it sorts in parallel",
+			[](UnitTest::Examiner & examiner) {
+				Parallel::ThreadPool pool(3);
+
+				auto keys = random_keys<float>(100003, -1, 1);
+				auto expected = keys;
+
+				std::vector<std::uint32_t> indices(keys.size()), expected_indices(keys.size());
+				for (std::size_t i = 0; i < indices.size(); i += 1) indices[i] = expected_indices[i] = i;
+
+				radix_sort(expected.data(), expected_indices.data(), expected.size());
+				Parallel::radix_sort(keys.data(), indices.data(), keys.size(), 1000, pool);
+
+				examiner.check(keys == expected);
+				examiner.check(indices == expected_indices);
+
+				auto doubles = random_keys<double>(50001, -1, 1);
+				auto expected_doubles = doubles;
+
+				std::sort(expected_doubles.begin(), expected_doubles.end());
+				Parallel::radix_sort(doubles.data(), doubles.size(), 1000, pool);
+
+				examiner.check(doubles == expected_doubles);
+			}
+		},
+	};
+}
@@ -0,0 +1,157 @@
+//
+//  Test.SparseMatrix.cpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Numerics/SparseMatrix.hpp>
+#include <Numerics/BlockSparseMatrix.hpp>
+#include <Numerics/Parallel/ThreadPool.hpp>
+#include <Numerics/Parallel/Sparse.hpp>
+
+namespace Numerics
+{
+	/// A banded test matrix with some duplicate entries.
+	template <typename NumericT>
+	std::vector<Triplet<NumericT>> banded_triplets(std::size_t size) {
+		std::vector<Triplet<NumericT>> triplets;
+
+		for (std::size_t i = 0; i < size; i += 1) {
+			triplets.push_back({i, i, 2});
+			triplets.push_back({i, (i * 7) % size, 1});
+			if (i > 0) triplets.push_back({i, i - 1, -1});
+			triplets.push_back({i, i, 1});
+		}
+
+		return triplets;
+	}
+
+	Matrix<3, 3, double> block_pattern(std::size_t seed) {
+		Matrix<3, 3, double> block;
+
+		for (std::size_t i = 0; i < 9; i += 1)
+			block[i] = double((seed * 5 + i * 3) % 7) - 3;
+
+		return block;
+	}
+
+	UnitTest::Suite SparseMatrixTestSuite {
+		"Numerics::SparseMatrix",
+
+		{"it sums duplicate triplets",
+			[](UnitTest::Examiner & examiner) {
+				SparseMatrix<float> m(3, 3, {{0, 0, 1}, {2, 1, 5}, {0, 0, 2}, {1, 2, 4}, {0, 2, 3}});
+
+				examiner.check_equal(m.non_zeros(), 4);
+				examiner.check_equal(m.at(0, 0), 3);
+				examiner.check_equal(m.at(0, 1), 0);
+				examiner.check_equal(m.at(0, 2), 3);
+				examiner.check_equal(m.at(2, 1), 5);
+			}
+		},
+
+		{"it can multiply by a vector",
+			[](UnitTest::Examiner & examiner) {
+				SparseMatrix<double> m(50, 50, banded_triplets<double>(50));
+				DynamicVector<double> x(50);
+
+				for (std::size_t i = 0; i < x.size(); i += 1) x[i] = double(i % 9) - 4;
+
+				examiner.check(m * x == m.dense() * x);
+
+				DynamicVector<double> y(50);
+				multiply_transpose(y, m, x);
+
+				examiner.check(y == m.dense().transpose() * x);
+				examiner.check(y == m.transpose() * x);
+			}
+		},
+
+		{"it can multiply in parallel",
+			[](UnitTest::Examiner & examiner) {
+				Parallel::ThreadPool pool(3);
+				SparseMatrix<double> m(1000, 1000, banded_triplets<double>(1000));
+				DynamicVector<double> x(1000, 1.5), y(1000), z(1000);
+
+				Parallel::multiply(y, m, x, 64, pool);
+				examiner.check(y == m * x);
+
+				Parallel::multiply_transpose(z, m, x, pool);
+				examiner.check(z == m.transpose() * x);
+			}
+		},
+
+		{"it can multiply 3x3 blocks",
+			[](UnitTest::Examiner & examiner) {
+				std::vector<Triplet<Matrix<3, 3, double>>> triplets;
+
+				for (std::size_t i = 0; i < 20; i += 1) {
+					triplets.push_back({i, i, block_pattern(i)});
+					triplets.push_back({i, (i * 3) % 20, block_pattern(i + 1)});
+					triplets.push_back({i, i, block_pattern(i + 2)});
+				}
+
+				BlockSparseMatrix<3, 3, double> m(20, 20, triplets);
+				auto scalar = m.scalar();
+
+				std::vector<Vector<3, double>> x(20), y(20, ZERO), z(20, ZERO);
+				DynamicVector<double> xs(60);
+
+				for (std::size_t i = 0; i < 60; i += 1)
+					xs[i] = x[i / 3][i % 3] = double(i % 5) - 2;
+
+				multiply(y, m, x);
+				auto ys = scalar * xs;
+
+				for (std::size_t i = 0; i < 60; i += 1)
+					examiner.check_equal(y[i / 3][i % 3], ys[i]);
+
+				multiply_transpose(z, m, x);
+				auto zs = scalar.transpose() * xs;
+
+				for (std::size_t i = 0; i < 60; i += 1)
+					examiner.check_equal(z[i / 3][i % 3], zs[i]);
+			}
+		},
+
+		{"it can multiply 3x3 float blocks in parallel",
+			[](UnitTest::Examiner & examiner) {
+				Parallel::ThreadPool pool(3);
+				std::vector<Triplet<Matrix<3, 3, float>>> triplets;
+
+				for (std::size_t i = 0; i < 500; i += 1) {
+					Matrix<3, 3, float> block = block_pattern(i);
+
+					triplets.push_back({i, i, block});
+					triplets.push_back({i, (i * 11) % 500, block});
+				}
+
+				BlockSparseMatrix<3, 3, float> m(500, 500, triplets);
+				auto scalar = m.scalar();
+
+				std::vector<Vec3> x(500), y(500, ZERO), z(500, ZERO);
+				DynamicVector<float> xs(1500);
+
+				for (std::size_t i = 0; i < 1500; i += 1)
+					xs[i] = x[i / 3][i % 3] = float(i % 5) - 2;
+
+				Parallel::multiply(y, m, x, 32, pool);
+				auto ys = scalar * xs;
+
+				Parallel::multiply_transpose(z, m, x, pool);
+				auto zs = scalar.transpose() * xs;
+
+				bool matches = true;
+
+				for (std::size_t i = 0; i < 1500; i += 1)
+					matches = matches && y[i / 3][i % 3] == ys[i] && z[i / 3][i % 3] == zs[i];
+
+				examiner.check(matches);
+			}
+		},
+	};
+}
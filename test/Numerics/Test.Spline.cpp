@@ -0,0 +1,148 @@
+//
+//  Test.Spline.cpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Numerics/Spline.hpp>
+#include <Numerics/Vector/IO.hpp>
+
+namespace Numerics
+{
+	using namespace UnitTest::Expectations;
+
+	typedef Vector<3, double> Point;
+
+	UnitTest::Suite SplineTestSuite {
+		"Numerics::Spline",
+
+		{"catmull-rom and hermite splines pass through their points",
+			[](UnitTest::Examiner & examiner) {
+				std::vector<Point> points = {{0, 0, 0}, {1, 2, 0}, {3, 3, 1}, {4, 0, 2}};
+				auto spline = Spline<3, double>::catmull_rom(points);
+
+				examiner.expect(spline.size()) == 3;
+
+				for (std::size_t i = 0; i < points.size(); i += 1)
+					examiner.check(spline.position(i).equivalent(points[i]));
+
+				examiner.check(spline.tangent(1).equivalent((points[2] - points[0]) * 0.5));
+
+				// The same segment using Interpolate::hermite:
+				auto expected = Interpolate::hermite(0.25, points[1], (points[2] - points[0]) * 0.5, points[2], (points[3] - points[1]) * 0.5);
+				examiner.check(spline.position(1.25).equivalent(expected));
+			}
+		},
+
+		{"bezier splines are controlled by their points",
+			[](UnitTest::Examiner & examiner) {
+				std::vector<Point> points = {{0, 0, 0}, {1, 1, 0}, {2, 1, 0}, {3, 0, 0}, {4, -1, 0}, {5, -1, 0}, {6, 0, 0}};
+				auto spline = Spline<3, double>::bezier(points);
+
+				examiner.expect(spline.size()) == 2;
+				examiner.check(spline.position(0).equivalent(points[0]));
+				examiner.check(spline.position(1).equivalent(points[3]));
+				examiner.check(spline.position(2).equivalent(points[6]));
+				examiner.check(spline.position(0.5).equivalent((points[0] + points[1] * 3 + points[2] * 3 + points[3]) / 8));
+				examiner.check(spline.tangent(0).equivalent((points[1] - points[0]) * 3));
+			}
+		},
+
+		{"natural cubic splines have continuous curvature",
+			[](UnitTest::Examiner & examiner) {
+				std::vector<Point> points = {{0, 0, 0}, {1, 3, 0}, {2, -1, 1}, {4, 0, 0}, {5, 2, -1}};
+				auto spline = Spline<3, double>::natural_cubic(points);
+
+				for (std::size_t i = 0; i < points.size(); i += 1)
+					examiner.check(spline.position(i).equivalent(points[i]));
+
+				auto & segments = spline.segments();
+
+				for (std::size_t i = 0; i + 1 < segments.size(); i += 1) {
+					auto & a = segments[i].coefficients, & b = segments[i+1].coefficients;
+
+					// The first and second derivatives at the end of one segment and the start of the next:
+					examiner.check(((a[1] + a[2] * 2 + a[3] * 3) - b[1]).length() < 1e-12);
+					examiner.check(((a[2] * 2 + a[3] * 6) - b[2] * 2).length() < 1e-12);
+				}
+
+				examiner.check(segments.front().coefficients[2].length() < 1e-12);
+				examiner.check((segments.back().coefficients[2] * 2 + segments.back().coefficients[3] * 6).length() < 1e-12);
+			}
+		},
+
+		{"it can be parameterized by arc length",
+			[](UnitTest::Examiner & examiner) {
+				// A straight line with uneven speed:
+				auto line = Spline<3, double>::bezier({{0, 0, 0}, {0.1, 0, 0}, {0.2, 0, 0}, {10, 0, 0}});
+
+				examiner.check(equivalent(line.length(), 10.0));
+
+				double error = 0;
+
+				for (double distance = 0; distance <= 10; distance += 0.25)
+					error = std::max(error, std::abs(line.position_at(distance)[X] - distance));
+
+				examiner << "Line error: " << error << std::endl;
+				examiner.check(error < 1e-6);
+
+				// A circle of radius 1 built from four Bézier arcs, which has a relative radial error of 2.7e-4:
+				const double K = 0.5522847498;
+				auto circle = Spline<3, double>::bezier({
+					{1, 0, 0}, {1, K, 0}, {K, 1, 0}, {0, 1, 0}, {-K, 1, 0}, {-1, K, 0}, {-1, 0, 0},
+					{-1, -K, 0}, {-K, -1, 0}, {0, -1, 0}, {K, -1, 0}, {1, -K, 0}, {1, 0, 0}
+				});
+
+				examiner << "Circumference: " << circle.length() << std::endl;
+				examiner.check(std::abs(circle.length() - 2 * M_PI) < 2e-3);
+
+				std::vector<double> distances;
+				for (std::size_t i = 0; i <= 100; i += 1)
+					distances.push_back(circle.length() * i / 100);
+
+				std::vector<Point> positions(distances.size()), tangents(distances.size());
+				circle.evaluate_at(distances.size(), distances.data(), positions.data(), tangents.data());
+
+				// Constant speed motion moves the same distance each step:
+				double step_error = 0;
+				for (std::size_t i = 1; i < positions.size(); i += 1)
+					step_error = std::max(step_error, std::abs((positions[i] - positions[i-1]).length() - (positions[1] - positions[0]).length()));
+
+				examiner << "Step error: " << step_error << std::endl;
+				examiner.check(step_error < 1e-5);
+				examiner.check(equivalent(double(tangents[0].length()), 1.0));
+
+				// A finer table can be built explicitly:
+				circle.prepare(64);
+				examiner.check(std::abs(circle.length() - 2 * M_PI) < 2e-3);
+			}
+		},
+
+		{"uniform evaluation by forward differencing matches direct evaluation",
+			[](UnitTest::Examiner & examiner) {
+				auto spline = Spline<3, float>::catmull_rom({{0, 0, 0}, {1, 2, 0}, {3, 3, 1}, {4, 0, 2}, {6, 1, 1}});
+
+				const std::size_t COUNT = 101;
+				std::vector<Vector<3, float>> positions(COUNT), tangents(COUNT), expected_positions(COUNT), expected_tangents(COUNT);
+				std::vector<float> parameters(COUNT);
+
+				for (std::size_t i = 0; i < COUNT; i += 1)
+					parameters[i] = -0.1f + 0.043f * i;
+
+				spline.evaluate_uniform(COUNT, -0.1f, 0.043f, positions.data(), tangents.data());
+				spline.evaluate(COUNT, parameters.data(), expected_positions.data(), expected_tangents.data());
+
+				float error = 0;
+				for (std::size_t i = 0; i < COUNT; i += 1)
+					error = std::max({error, float((positions[i] - expected_positions[i]).length()), float((tangents[i] - expected_tangents[i]).length())});
+
+				examiner << "Forward differencing error: " << error << std::endl;
+				examiner.check(error < 1e-4f);
+			}
+		},
+	};
+}
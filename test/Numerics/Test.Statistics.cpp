@@ -0,0 +1,196 @@
+//
+//  Test.Statistics.cpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Numerics/Statistics.hpp>
+#include <Numerics/Parallel/Statistics.hpp>
+#include <Numerics/Parallel/ThreadPool.hpp>
+
+#include <random>
+#include <vector>
+#include <cmath>
+
+namespace Numerics
+{
+	using namespace UnitTest::Expectations;
+
+	template <std::size_t D, typename NumericT>
+	std::vector<Vector<D, NumericT>> random_samples(std::size_t count, NumericT offset)
+	{
+		std::minstd_rand random(count);
+		std::normal_distribution<NumericT> distribution(0, 1);
+
+		std::vector<Vector<D, NumericT>> samples(count);
+
+		// Correlated components with a large offset, which the naive sum of squares can't handle:
+		for (auto & sample : samples) {
+			NumericT common = distribution(random);
+
+			for (std::size_t i = 0; i < D; i += 1)
+				sample[i] = offset + common * (i + 1) + distribution(random);
+		}
+
+		return samples;
+	}
+
+	/// The covariance computed in two passes with extended precision.
+	template <std::size_t D, typename NumericT>
+	Matrix<D, D, long double> reference_covariance(const std::vector<Vector<D, NumericT>> & samples, Vector<D, long double> & mean)
+	{
+		mean = Vector<D, long double>(ZERO);
+
+		for (const auto & sample : samples)
+			for (std::size_t i = 0; i < D; i += 1)
+				mean[i] += sample[i];
+
+		mean /= (long double)samples.size();
+
+		Matrix<D, D, long double> covariance(ZERO);
+
+		for (const auto & sample : samples)
+			for (std::size_t j = 0; j < D; j += 1)
+				for (std::size_t i = 0; i < D; i += 1)
+					covariance.at(i, j) += (sample[i] - mean[i]) * (sample[j] - mean[j]);
+
+		for (auto & value : covariance)
+			value /= samples.size() - 1;
+
+		return covariance;
+	}
+
+	template <std::size_t D, typename NumericT>
+	bool close(const Statistics<D, NumericT> & statistics, const std::vector<Vector<D, NumericT>> & samples, long double tolerance)
+	{
+		Vector<D, long double> mean;
+		auto expected = reference_covariance(samples, mean);
+		auto covariance = statistics.covariance();
+
+		if (statistics.count() != samples.size()) return false;
+
+		for (std::size_t i = 0; i < D; i += 1)
+			if (std::abs(statistics.mean()[i] - mean[i]) > tolerance * std::abs(mean[i])) return false;
+
+		for (std::size_t i = 0; i < D*D; i += 1)
+			if (std::abs(covariance[i] - expected[i]) > tolerance * std::abs(expected.at(i % D, i % D))) return false;
+
+		return true;
+	}
+
+	UnitTest::Suite StatisticsTestSuite {
+		"Numerics::Statistics",
+
+		{"it computes the mean, covariance and bounds of samples",
+			[](UnitTest::Examiner & examiner) {
+				std::vector<Vector<3, float>> samples = {{1, 2, 3}, {3, 2, 1}, {2, 5, 2}, {2, -1, 2}};
+
+				Statistics<3, float> statistics;
+				for (const auto & sample : samples) statistics.add(sample);
+
+				examiner.expect(statistics.count()) == 4;
+				examiner.check(statistics.mean().equivalent({2, 2, 2}));
+				examiner.check(statistics.minimum().equivalent({1, -1, 1}));
+				examiner.check(statistics.maximum().equivalent({3, 5, 3}));
+
+				// The deviations are (-1, 0, 1), (1, 0, -1), (0, 3, 0) and (0, -3, 0):
+				examiner.check(statistics.products().equivalent(Matrix<3, 3, float>{2, 0, -2, 0, 18, 0, -2, 0, 2}));
+				examiner.check(statistics.variance().equivalent({2.0f / 3, 6, 2.0f / 3}));
+				examiner.check(statistics.variance(false).equivalent({0.5f, 4.5f, 0.5f}));
+
+				// The batch update gives the same result:
+				Statistics<3, float> batch;
+				batch.add(samples.data(), samples.size());
+
+				examiner.check(batch.mean().equivalent(statistics.mean()));
+				examiner.check(batch.covariance().equivalent(statistics.covariance()));
+				examiner.check(batch.minimum().equivalent(statistics.minimum()));
+				examiner.check(batch.maximum().equivalent(statistics.maximum()));
+
+				Statistics<6, double> empty;
+				examiner.check(empty.empty());
+				examiner.check(empty.covariance().equivalent(Matrix<6, 6, double>(ZERO)));
+			}
+		},
+
+		{"it is accurate for samples with a large offset",
+			[](UnitTest::Examiner & examiner) {
+				auto samples = random_samples<3, float>(100003, 1000);
+
+				Statistics<3, float> streaming, batch;
+
+				for (const auto & sample : samples) streaming.add(sample);
+				batch.add(samples.data(), samples.size());
+
+				examiner.check(close(streaming, samples, 1e-3));
+				examiner.check(close(batch, samples, 1e-4));
+
+				auto wide = random_samples<6, double>(10007, 1e6);
+
+				Statistics<6, double> statistics;
+				statistics.add(wide.data(), wide.size());
+
+				examiner.check(close(statistics, wide, 1e-9));
+
+				// Covariance matrices are symmetric:
+				examiner.check(statistics.covariance().equivalent(statistics.covariance().transpose()));
+			}
+		},
+
+		{"merging partial results is the same as adding every sample",
+			[](UnitTest::Examiner & examiner) {
+				auto samples = random_samples<6, double>(3000, 10);
+
+				Statistics<6, double> total, left, middle, right;
+				total.add(samples.data(), samples.size());
+
+				left.add(samples.data(), 1000);
+				middle.add(samples.data() + 1000, 1);
+				right.add(samples.data() + 1001, 1999);
+
+				auto grouped = (left + middle) + right, regrouped = left + (middle + right);
+
+				examiner.expect(grouped.count()) == 3000;
+				examiner.check(grouped.mean().equivalent(total.mean()));
+				examiner.check(grouped.covariance().equivalent(total.covariance()));
+				examiner.check(regrouped.covariance().equivalent(total.covariance()));
+				examiner.check(grouped.minimum() == total.minimum());
+				examiner.check(grouped.maximum() == total.maximum());
+
+				// Merging an empty accumulator has no effect:
+				Statistics<6, double> empty;
+				examiner.check((empty + total).covariance() == total.covariance());
+				examiner.check((total + empty).mean() == total.mean());
+			}
+		},
+
+		{"it computes statistics in parallel",
+			[](UnitTest::Examiner & examiner) {
+				Parallel::ThreadPool pool(3);
+
+				auto samples = random_samples<3, double>(200001, 5);
+
+				auto serial = Parallel::statistics(samples.data(), samples.size(), 1 << 30, pool);
+				auto parallel = Parallel::statistics(samples.data(), samples.size(), 10000, pool);
+
+				// The chunks are merged in a different grouping, so the results differ by rounding:
+				examiner.expect(parallel.count()) == samples.size();
+				examiner.check(close(serial, samples, 1e-9));
+				examiner.check(close(parallel, samples, 1e-9));
+
+				// The result doesn't depend on the scheduling or the executor:
+				auto again = Parallel::statistics(samples.data(), samples.size(), 10000, pool);
+				examiner.check(again.covariance() == parallel.covariance());
+
+				Parallel::SerialExecutor executor;
+				auto sequential = Parallel::statistics(samples.data(), samples.size(), 10000, executor);
+				examiner.check(sequential.mean() == parallel.mean());
+				examiner.check(sequential.covariance() == parallel.covariance());
+			}
+		},
+	};
+}
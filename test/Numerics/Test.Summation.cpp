@@ -0,0 +1,141 @@
+//
+//  Test.Summation.cpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Numerics/Summation.hpp>
+#include <Numerics/Vector.hpp>
+#include <Numerics/DynamicVector.hpp>
+
+#include <random>
+#include <cmath>
+#include <vector>
+
+namespace Numerics
+{
+	using namespace UnitTest::Expectations;
+
+	UnitTest::Suite SummationTestSuite {
+		"Numerics::Summation",
+
+		{"every policy computes exact sums exactly",
+			[](UnitTest::Examiner & examiner) {
+				std::size_t errors = 0;
+
+				// Every length up to a few SIMD widths, so that the remainders are checked:
+				for (std::size_t size = 0; size < 40; size += 1) {
+					std::vector<float> x(size), y(size);
+					float expected_sum = 0, expected_dot = 0;
+
+					for (std::size_t i = 0; i < size; i += 1) {
+						x[i] = float(i) - 7;
+						y[i] = float(i % 5);
+
+						expected_sum += x[i];
+						expected_dot += x[i] * y[i];
+					}
+
+					if (sum<SERIAL>(size, x.data()) != expected_sum) errors += 1;
+					if (sum<UNROLLED>(size, x.data()) != expected_sum) errors += 1;
+					if (sum<PAIRWISE>(size, x.data()) != expected_sum) errors += 1;
+					if (sum<COMPENSATED>(size, x.data()) != expected_sum) errors += 1;
+
+					if (dot<SERIAL>(size, x.data(), y.data()) != expected_dot) errors += 1;
+					if (dot<UNROLLED>(size, x.data(), y.data()) != expected_dot) errors += 1;
+					if (dot<PAIRWISE>(size, x.data(), y.data()) != expected_dot) errors += 1;
+					if (dot<COMPENSATED>(size, x.data(), y.data()) != expected_dot) errors += 1;
+				}
+
+				examiner.expect(errors) == 0;
+			}
+		},
+
+		{"compensated summation is accurate to the last place",
+			[](UnitTest::Examiner & examiner) {
+				std::minstd_rand random(17);
+				std::uniform_real_distribution<float> uniform(0, 1);
+
+				std::vector<float> x(1000000);
+				long double reference = 0;
+
+				for (auto & value : x) {
+					value = uniform(random);
+					reference += value;
+				}
+
+				auto error = [&](float value) {return std::abs(value - reference) / reference;};
+
+				float serial = sum<SERIAL>(x.size(), x.data());
+				float pairwise = sum<PAIRWISE>(x.size(), x.data());
+				float compensated = sum<COMPENSATED>(x.size(), x.data());
+
+				examiner << "serial: " << error(serial) << " pairwise: " << error(pairwise) << " compensated: " << error(compensated) << std::endl;
+
+				examiner.expect(error(pairwise) < error(serial)).to(be_true);
+				examiner.expect(error(pairwise) < 1e-6).to(be_true);
+				examiner.expect(error(compensated) <= std::numeric_limits<float>::epsilon() / 2).to(be_true);
+
+				double generic = sum<COMPENSATED>(x.size(), std::vector<double>(x.begin(), x.end()).data());
+				examiner.expect(std::abs(generic - reference) / reference < 1e-15).to(be_true);
+			}
+		},
+
+		{"compensated inner products survive cancellation",
+			[](UnitTest::Examiner & examiner) {
+				// The large terms cancel exactly, and the products have rounding errors which don't:
+				std::vector<float> x = {1e8f, 1, -1e8f, 3.0f, 1e-3f, 1.1f, 1.1f, -1.1f, 2.5f, -2.5f};
+				std::vector<float> y = {1, 1, 1, 1.0f / 3, 1, 1.1f, -1.1f, 1.1f, 3.1f, 3.1f};
+
+				long double reference = 0;
+				for (std::size_t i = 0; i < x.size(); i += 1)
+					reference += (long double)x[i] * y[i];
+
+				float compensated = dot<COMPENSATED>(x.size(), x.data(), y.data());
+				float serial = dot<SERIAL>(x.size(), x.data(), y.data());
+
+				examiner << "serial: " << serial << " compensated: " << compensated << " reference: " << double(reference) << std::endl;
+
+				// Dot2 is as accurate as computing in twice the precision, and the result is scaled by the condition number of the sum, which is about 1e8 here:
+				examiner.expect(std::abs(compensated - reference) < 1e-6).to(be_true);
+				examiner.expect(std::abs(serial - reference) > 0.5).to(be_true);
+
+				std::vector<double> a(x.begin(), x.end()), b(y.begin(), y.end());
+				examiner.expect(equivalent(dot<COMPENSATED>(a.size(), a.data(), b.data()), double(reference))).to(be_true);
+			}
+		},
+
+		{"it reduces arrays of vectors",
+			[](UnitTest::Examiner & examiner) {
+				std::vector<Vector<3, float>> points = {{1, 5, -2}, {-3, 2, 8}, {4, -1, 0}, {0, 0, 1}, {2, 7, -6}};
+
+				examiner.check(sum(points.size(), points.data()).equivalent({4, 13, 1}));
+				examiner.check(sum<COMPENSATED>(points.size(), points.data()).equivalent({4, 13, 1}));
+				examiner.check(minimum(points.size(), points.data()).equivalent({-3, -1, -6}));
+				examiner.check(maximum(points.size(), points.data()).equivalent({4, 7, 8}));
+
+				std::vector<float> products(points.size());
+				dot(points.size(), points.data(), points.data() + 0, products.data());
+
+				examiner.expect(products[1]) == 77;
+
+				std::vector<double> values = {3, -1, 4, 1, -5, 9, 2, -6};
+				examiner.expect(minimum(values.size(), values.data())) == -6;
+				examiner.expect(maximum(values.size(), values.data())) == 9;
+
+				Vector<3, float> v = {1e8f, 1, -1e8f};
+				examiner.expect(v.sum().value) == 0;
+				examiner.expect(v.sum<COMPENSATED>().value) == 1;
+				examiner.expect(v.dot<COMPENSATED>(Vector<3, float>{1, 1, 1}).value) == 1;
+
+				DynamicVector<float> d = {1e8f, 1, -1e8f, 1};
+				examiner.expect(d.sum<COMPENSATED>().value) == 2;
+				examiner.expect(dot<COMPENSATED>(d, DynamicVector<float>(4, 1)).value) == 2;
+			}
+		},
+	};
+}
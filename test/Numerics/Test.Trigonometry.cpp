@@ -0,0 +1,183 @@
+//
+//  Test.Trigonometry.cpp
+//  This file is part of the "Numerics" project and released under the MIT License.
+//
+//  Created by Samuel Williams on 19/10/2026.
+//  Copyright, 2026, by Samuel Williams. All rights reserved.
+//
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Numerics/Trigonometry.hpp>
+#include <Numerics/Radians.hpp>
+#include <Numerics/Number.hpp>
+
+#include <random>
+#include <vector>
+
+namespace Numerics
+{
+	using namespace UnitTest::Expectations;
+
+	template <typename FloatT>
+	std::vector<FloatT> uniform(FloatT minimum, FloatT maximum, std::size_t count)
+	{
+		std::minstd_rand random(23);
+		std::uniform_real_distribution<FloatT> distribution(minimum, maximum);
+
+		std::vector<FloatT> values(count);
+
+		for (auto & value : values)
+			value = distribution(random);
+
+		return values;
+	}
+
+	UnitTest::Suite TrigonometryTestSuite {
+		"Numerics::Trigonometry",
+
+		{"it computes sine and cosine accurately",
+			[](UnitTest::Examiner & examiner) {
+				double float_error = 0, double_error = 0, fast_error = 0;
+
+				for (double x : uniform(-100.0, 100.0, 100000)) {
+					long double reference_sine = std::sin((long double)x), reference_cosine = std::cos((long double)x);
+
+					double s, c;
+					Trigonometry::sin_cos(x, s, c);
+					double_error = std::max<double>(double_error, std::max(std::abs(s - reference_sine), std::abs(c - reference_cosine)));
+
+					Trigonometry::sin_cos<FAST>(x, s, c);
+					fast_error = std::max<double>(fast_error, std::max(std::abs(s - reference_sine), std::abs(c - reference_cosine)));
+
+					float y = x, sf, cf;
+					Trigonometry::sin_cos(y, sf, cf);
+					float_error = std::max(float_error, std::max(std::abs(sf - std::sin(double(y))), std::abs(cf - std::cos(double(y)))));
+				}
+
+				examiner << "float: " << float_error << " double: " << double_error << " fast: " << fast_error << std::endl;
+
+				examiner.expect(float_error < 2e-7).to(be_true);
+				examiner.expect(double_error < 4e-16).to(be_true);
+				examiner.expect(fast_error < 1e-8).to(be_true);
+
+				// Special values and arguments beyond the reduction limit:
+				examiner.expect(Trigonometry::sin(0.0)) == 0.0;
+				examiner.expect(Trigonometry::cos(0.0)) == 1.0;
+				examiner.expect(Trigonometry::sin(1e10)) == std::sin(1e10);
+				examiner.expect(std::isnan(Trigonometry::cos(INFINITY))).to(be_true);
+				examiner.expect(std::isnan(Trigonometry::sin(NAN))).to(be_true);
+			}
+		},
+
+		{"it computes inverse functions accurately",
+			[](UnitTest::Examiner & examiner) {
+				double atan2_error = 0, acos_error = 0, asin_error = 0, atan2_float_error = 0, acos_float_error = 0;
+
+				auto xs = uniform(-10.0, 10.0, 20000), ys = uniform(-1.0, 1.0, 20000);
+
+				for (std::size_t i = 0; i < xs.size(); i += 1) {
+					double x = xs[i], y = ys[i] * 10;
+
+					atan2_error = std::max<double>(atan2_error, std::abs(Trigonometry::atan2(y, x) - std::atan2((long double)y, (long double)x)));
+					acos_error = std::max<double>(acos_error, std::abs(Trigonometry::acos(ys[i]) - std::acos((long double)ys[i])));
+					asin_error = std::max<double>(asin_error, std::abs(Trigonometry::asin(ys[i]) - std::asin((long double)ys[i])));
+
+					float xf = x, yf = y, vf = ys[i];
+					atan2_float_error = std::max(atan2_float_error, std::abs(Trigonometry::atan2(yf, xf) - std::atan2(double(yf), double(xf))));
+					acos_float_error = std::max(acos_float_error, std::abs(Trigonometry::acos(vf) - std::acos(double(vf))));
+				}
+
+				examiner << "atan2: " << atan2_error << " acos: " << acos_error << " asin: " << asin_error << std::endl;
+				examiner << "atan2 (float): " << atan2_float_error << " acos (float): " << acos_float_error << std::endl;
+
+				examiner.expect(atan2_error < 1e-15).to(be_true);
+				examiner.expect(acos_error < 1e-15).to(be_true);
+				examiner.expect(asin_error < 1e-15).to(be_true);
+				examiner.expect(atan2_float_error < 5e-7).to(be_true);
+				examiner.expect(acos_float_error < 5e-7).to(be_true);
+
+				// The signs of zero and infinity are handled the same way as the standard library:
+				for (double y : {0.0, -0.0, 1.0, -1.0, double(INFINITY), -double(INFINITY)}) {
+					for (double x : {0.0, -0.0, 1.0, -1.0, double(INFINITY), -double(INFINITY)}) {
+						examiner.expect(equivalent(Trigonometry::atan2(y, x), std::atan2(y, x))).to(be_true);
+						examiner.expect(std::signbit(Trigonometry::atan2(y, x))) == std::signbit(std::atan2(y, x));
+					}
+				}
+
+				examiner.expect(Trigonometry::acos(1.0)) == 0.0;
+				examiner.expect(equivalent(Trigonometry::acos(-1.0), M_PI)).to(be_true);
+				examiner.expect(std::isnan(Trigonometry::acos(1.5))).to(be_true);
+			}
+		},
+
+		{"array functions match the scalar functions",
+			[](UnitTest::Examiner & examiner) {
+				auto angles = uniform(-20.0f, 20.0f, 1027);
+				auto values = uniform(-1.0f, 1.0f, 1027);
+
+				// Values beyond the reduction limit and special values are handled one at a time:
+				angles[5] = 1e6f;
+				angles[6] = NAN;
+				values[7] = 0;
+
+				std::vector<float> sines(angles.size()), cosines(angles.size()), arctangents(angles.size()), arccosines(angles.size());
+
+				Trigonometry::sin_cos(angles.data(), sines.data(), cosines.data(), angles.size());
+				Trigonometry::atan2(values.data(), angles.data(), arctangents.data(), angles.size());
+				Trigonometry::acos(values.data(), arccosines.data(), values.size());
+
+				std::size_t mismatches = 0;
+
+				auto compare = [&](float a, float b) {
+					if (!(std::abs(a - b) <= 2.5e-7f) && !(std::isnan(a) && std::isnan(b))) mismatches += 1;
+				};
+
+				for (std::size_t i = 0; i < angles.size(); i += 1) {
+					float s, c;
+					Trigonometry::sin_cos(angles[i], s, c);
+
+					compare(sines[i], s);
+					compare(cosines[i], c);
+					compare(arctangents[i], Trigonometry::atan2(values[i], angles[i]));
+					compare(arccosines[i], Trigonometry::acos(values[i]));
+				}
+
+				examiner.expect(mismatches) == 0;
+
+				std::vector<double> double_sines(4), double_cosines(4), double_angles = {0, M_PI_2, M_PI, -M_PI_2};
+				Trigonometry::sin_cos(double_angles.data(), double_sines.data(), double_cosines.data(), double_angles.size());
+
+				examiner.expect(double_sines[1]) == 1.0;
+				examiner.expect(double_cosines[2]) == -1.0;
+				examiner.expect(double_sines[3]) == -1.0;
+			}
+		},
+
+		{"it wraps angles",
+			[](UnitTest::Examiner & examiner) {
+				examiner.expect(equivalent(Trigonometry::wrap(3 * M_PI), M_PI)).to(be_true);
+				examiner.expect(equivalent(Trigonometry::wrap(-M_PI), M_PI)).to(be_true);
+				examiner.expect(equivalent(Trigonometry::wrap(7.0), 7.0 - 2 * M_PI)).to(be_true);
+				examiner.expect(equivalent(Trigonometry::wrap(-7.0f), -7.0f + 2 * float(M_PI))).to(be_true);
+
+				for (double x : uniform(-1000.0, 1000.0, 1000)) {
+					double wrapped = Trigonometry::wrap(x);
+
+					examiner.expect(wrapped > -M_PI && wrapped <= M_PI).to(be_true);
+					examiner.expect(std::abs(wrapped - std::remainder(x, 2 * M_PI)) < 1e-12).to(be_true);
+				}
+
+				examiner.expect((350_deg).offset_to(10_deg)).to(be_equivalent(-20_deg));
+				examiner.expect((10_deg).offset_to(350_deg)).to(be_equivalent(20_deg));
+				examiner.expect((720_deg + 30_deg).wrap()).to(be_equivalent(30_deg));
+
+				double s, c;
+				(30_deg).sin_cos(s, c);
+
+				examiner.expect(equivalent(s, 0.5)).to(be_true);
+				examiner.expect(equivalent(c, std::sqrt(3.0) / 2)).to(be_true);
+			}
+		},
+	};
+}
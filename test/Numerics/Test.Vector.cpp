@@ -10,9 +10,82 @@
 
 #include <Numerics/Vector.hpp>
 #include <Numerics/Radians.hpp>
+#include <Numerics/Vector/Compress.hpp>
+#include <Numerics/Vector/Curve.hpp>
+
+#include <random>
+#include <vector>
 
 namespace Numerics
 {
+	// Interleave one bit at a time, as a reference for the Morton codes:
+	template <typename CurveT, typename CodeT>
+	CodeT interleave_bits(const typename CurveT::CoordinateT & coordinate)
+	{
+		const std::size_t D = coordinate.size();
+		CodeT code = 0;
+		
+		for (std::size_t bit = 0; bit < CurveT::BITS; bit += 1)
+			for (std::size_t i = 0; i < D; i += 1)
+				code |= CodeT((coordinate[i] >> bit) & 1) << (bit * D + i);
+		
+		return code;
+	}
+	
+	template <typename CurveT, typename CodeT>
+	bool check_morton(std::size_t count)
+	{
+		std::mt19937 random(count);
+		bool matches = true;
+		
+		for (std::size_t k = 0; k < count; k += 1) {
+			typename CurveT::CoordinateT coordinate;
+			
+			for (auto & component : coordinate)
+				component = random() & ((std::uint64_t(1) << CurveT::BITS) - 1);
+			
+			CodeT code = CurveT::encode(coordinate);
+			
+			matches = matches && code == interleave_bits<CurveT, CodeT>(coordinate) && CurveT::decode(code) == coordinate;
+		}
+		
+		return matches;
+	}
+	
+	// Every index decodes to a coordinate adjacent to the previous one, and encodes back to the same index:
+	template <typename CurveT, typename CodeT>
+	bool check_hilbert(std::size_t count)
+	{
+		auto previous = CurveT::decode(0);
+		bool adjacent = previous == typename CurveT::CoordinateT(ZERO);
+		
+		for (CodeT index = 1; index < count; index += 1) {
+			auto coordinate = CurveT::decode(index);
+			std::uint32_t distance = 0;
+			
+			for (std::size_t i = 0; i < coordinate.size(); i += 1)
+				distance += coordinate[i] > previous[i] ? coordinate[i] - previous[i] : previous[i] - coordinate[i];
+			
+			adjacent = adjacent && distance == 1 && CurveT::encode(coordinate) == index;
+			previous = coordinate;
+		}
+		
+		return adjacent;
+	}
+	
+	// Bulk encoding gives the same codes as encoding each value:
+	template <typename QuantizationT, typename VectorT>
+	bool check_quantization(const QuantizationT & quantization, const std::vector<VectorT> & values)
+	{
+		std::vector<typename QuantizationT::CodeT> codes(values.size());
+		quantization.encode(codes.data(), values.data(), values.size());
+		
+		for (std::size_t i = 0; i < values.size(); i += 1)
+			if (!(codes[i] == quantization.encode(values[i]))) return false;
+		
+		return true;
+	}
+	
 	UnitTest::Suite VectorTestSuite {
 		"Numerics::Vector",
 		
@@ -41,5 +114,238 @@ namespace Numerics
 				examiner.expect(vector(0.0, 0.0, 2.5).normalize(2)) == vector(0.0, 0.0, 2.0);
 			}
 		},
+
+		{"fast precision is within a few units in the last place",
+			[](UnitTest::Examiner & examiner) {
+				typedef FloatEquivalenceTraits<float> Traits;
+
+				std::minstd_rand random(11);
+				std::uniform_real_distribution<float> uniform(-100, 100);
+
+				Traits::UnsignedT length_units = 0, normalize_units = 0;
+				double angle_error = 0, double_error = 0;
+
+				for (std::size_t i = 0; i < 10000; i += 1) {
+					Vector<3, float> a = {uniform(random), uniform(random), uniform(random)}, b = {uniform(random), uniform(random), uniform(random)};
+
+					length_units = std::max(length_units, Traits::integral_difference(a.length<FAST>(), a.length()));
+
+					auto exact = a.normalize(), fast = a.normalize<FAST>();
+					for (std::size_t j = 0; j < 3; j += 1)
+						if (std::abs(exact[j]) > 1e-3f)
+							normalize_units = std::max(normalize_units, Traits::integral_difference(fast[j], exact[j]));
+
+					angle_error = std::max<double>(angle_error, std::abs(a.angle_between<FAST>(b).value - a.angle_between(b).value));
+
+					Vector<3, double> c = a, d = c.normalize<FAST>();
+					double_error = std::max(double_error, std::abs(d.length() - 1.0));
+				}
+
+				examiner << "length: " << length_units << " normalize: " << normalize_units << " units, angle: " << angle_error << " double: " << double_error << std::endl;
+
+				examiner.check(length_units <= EpsilonTraits<float, 0>::UNITS);
+				examiner.check(normalize_units <= EpsilonTraits<float, 0>::UNITS);
+				examiner.check(angle_error < 1e-3);
+				examiner.check(double_error < 1e-6);
+
+				examiner.expect(vector(0.0f, 0.0f, 0.0f).length<FAST>()) == 0.0f;
+				examiner.expect(vector(0.0f, 0.0f, 0.0f).normalize<FAST>()) == vector(0.0f, 0.0f, 0.0f);
+				examiner.check(vector(3.0f, 0.0f, 4.0f).normalize<FAST>().equivalent(vector(0.6f, 0.0f, 0.8f)));
+				examiner.check(vector(1.0f, 0.0f, 0.0f).angle_between<FAST>(vector(0.0f, 2.0f, 0.0f)).equivalent(R90));
+				examiner.check(surface_normal<FAST>(vector(0.0f, 0.0f, 0.0f), vector(2.0f, 0.0f, 0.0f), vector(2.0f, 2.0f, 0.0f)).equivalent(vector(0.0f, 0.0f, 1.0f)));
+
+				examiner << "The exact angle doesn't overflow the product of the squared lengths." << std::endl;
+				examiner.check(vector(1e10f, 0.0f, 0.0f).angle_between(vector(1e10f, 1e10f, 0.0f)).equivalent(R45));
+				examiner.check(vector(1e-12f, 0.0f, 0.0f).angle_between(vector(1e-12f, 1e-12f, 0.0f)).equivalent(R45));
+
+				examiner << "Small vectors are normalized with both precisions." << std::endl;
+				examiner.check(vector(1e-4f, 0.0f, 0.0f).normalize<FAST>().equivalent(vector(1.0f, 0.0f, 0.0f)));
+				examiner.check(vector(1e-4f, 0.0f, 0.0f).normalize().equivalent(vector(1.0f, 0.0f, 0.0f)));
+				examiner.check(surface_normal<FAST>(vector(0.0f, 0.0f, 0.0f), vector(0.02f, 0.0f, 0.0f), vector(0.02f, 0.02f, 0.0f)).equivalent(vector(0.0f, 0.0f, 1.0f)));
+
+				examiner << "Denormal squared lengths use the exact reciprocal square root." << std::endl;
+				examiner.check(std::abs(vector(1e-20f, 0.0f, 0.0f).length<FAST>().value - 1e-20f) < 1e-25f);
+			}
+		},
+
+		{"it can compress unit vectors",
+			[](UnitTest::Examiner & examiner) {
+				std::minstd_rand random(3);
+				std::normal_distribution<float> normal;
+
+				std::vector<Vector<3, float>> normals = {{0, 0, 1}, {0, 0, -1}, {1, 0, 0}, {0, -1, 0}, {0.6f, 0.0f, -0.8f}};
+
+				for (std::size_t i = 0; i < 2000; i += 1)
+					normals.push_back(Vector<3, float>(normal(random), normal(random), normal(random)).normalize());
+
+				auto maximum_angle = [&](const std::vector<Vector<3, float>> & decoded) {
+					float maximum = 0;
+
+					for (std::size_t i = 0; i < normals.size(); i += 1)
+						maximum = std::max(maximum, 2 * std::asin(std::min(float((decoded[i] - normals[i]).length()) / 2, 1.0f)));
+
+					return maximum;
+				};
+
+				std::vector<Vector<3, float>> decoded(normals.size());
+
+				std::vector<std::uint16_t> packed16(normals.size());
+				Octahedral16::encode(packed16.data(), normals.data(), normals.size());
+				Octahedral16::decode(decoded.data(), packed16.data(), packed16.size());
+				examiner << "16-bit encoding error: " << maximum_angle(decoded) << std::endl;
+				examiner.check(maximum_angle(decoded) <= Octahedral16::maximum_angular_error());
+
+				bool matches = true;
+				for (std::size_t i = 0; i < normals.size(); i += 1)
+					matches = matches && packed16[i] == Octahedral16::encode(normals[i]) && decoded[i].equivalent(Octahedral16::decode(packed16[i]));
+				examiner << "Bulk encoding matches scalar encoding." << std::endl;
+				examiner.check(matches);
+
+				std::vector<UInt24> packed24(normals.size());
+				Octahedral24::encode(packed24.data(), normals.data(), normals.size());
+				Octahedral24::decode(decoded.data(), packed24.data(), packed24.size());
+				examiner << "24-bit encoding error: " << maximum_angle(decoded) << std::endl;
+				examiner.check(maximum_angle(decoded) <= Octahedral24::maximum_angular_error());
+
+				matches = true;
+				for (std::size_t i = 0; i < normals.size(); i += 1)
+					matches = matches && std::uint32_t(packed24[i]) == std::uint32_t(Octahedral24::encode(normals[i])) && decoded[i].equivalent(Octahedral24::decode(packed24[i]));
+				examiner.check(matches);
+
+				std::vector<std::uint32_t> packed32(normals.size());
+				Octahedral32::encode(packed32.data(), normals.data(), normals.size());
+				Octahedral32::decode(decoded.data(), packed32.data(), packed32.size());
+				examiner << "32-bit encoding error: " << maximum_angle(decoded) << std::endl;
+				examiner.check(maximum_angle(decoded) <= Octahedral32::maximum_angular_error());
+
+				matches = true;
+				for (std::size_t i = 0; i < normals.size(); i += 1)
+					matches = matches && packed32[i] == Octahedral32::encode(normals[i]) && decoded[i].equivalent(Octahedral32::decode(packed32[i]));
+				examiner.check(matches);
+			}
+		},
+
+		{"it can quantize bounded vectors",
+			[](UnitTest::Examiner & examiner) {
+				Quantization<3, 12, float> quantization({-10, 0, 5}, {10, 100, 6});
+
+				std::minstd_rand random(5);
+				std::uniform_real_distribution<float> uniform(0, 1);
+
+				std::vector<Vector<3, float>> values;
+				for (std::size_t i = 0; i < 1000; i += 1)
+					values.push_back({uniform(random) * 20 - 10, uniform(random) * 100, uniform(random) + 5});
+
+				std::vector<Vector<3, std::uint16_t>> codes(values.size());
+				std::vector<Vector<3, float>> decoded(values.size());
+
+				quantization.encode(codes.data(), values.data(), values.size());
+				quantization.decode(decoded.data(), codes.data(), codes.size());
+
+				bool within_error = true;
+				for (std::size_t i = 0; i < values.size(); i += 1)
+					within_error = within_error && quantization.equivalent(decoded[i], values[i]);
+				examiner.check(within_error);
+
+				examiner << "Decoded values are exactly representable." << std::endl;
+				examiner.check(quantization.decode(quantization.encode(decoded[0])) == decoded[0]);
+
+				examiner << "Values outside the bounds are clamped." << std::endl;
+				examiner.check(quantization.equivalent(quantization.decode(quantization.encode({-20, 200, 5.5})), Vector<3, float>(-10, 100, 5.5)));
+
+				examiner << "Bulk encoding matches scalar encoding." << std::endl;
+				values.push_back({-20, 200, 7});
+				examiner.check(check_quantization(quantization, values));
+				examiner.check(check_quantization(Quantization<3, 8, float>({-10, 0, 5}, {10, 100, 6}), values));
+				examiner.check(check_quantization(Quantization<3, 20, float>({-10, 0, 5}, {10, 100, 6}), values));
+			}
+		},
+		
+		{"it can encode Morton codes",
+			[](UnitTest::Examiner & examiner) {
+				examiner.check(check_morton<Morton<2, std::uint32_t>, std::uint32_t>(1000));
+				examiner.check(check_morton<Morton<2, std::uint64_t>, std::uint64_t>(1000));
+				examiner.check(check_morton<Morton<3, std::uint32_t>, std::uint32_t>(1000));
+				examiner.check(check_morton<Morton<3, std::uint64_t>, std::uint64_t>(1000));
+				
+				examiner.expect(Morton<3>::encode({1, 0, 0})) == 1;
+				examiner.expect(Morton<3>::encode({0, 0, 1})) == 4;
+				examiner.expect(Morton<2>::encode({3, 1})) == 7;
+				
+				examiner << "Bits above the maximum are ignored." << std::endl;
+				examiner.expect(Morton<3, std::uint32_t>::encode({1024 + 1, 0, 0})) == 1;
+			}
+		},
+		
+		{"it can encode Hilbert indices",
+			[](UnitTest::Examiner & examiner) {
+				examiner.check(check_hilbert<Hilbert<2, std::uint32_t>, std::uint32_t>(1 << 12));
+				examiner.check(check_hilbert<Hilbert<2, std::uint64_t>, std::uint64_t>(1 << 12));
+				examiner.check(check_hilbert<Hilbert<3, std::uint32_t>, std::uint32_t>(1 << 12));
+				examiner.check(check_hilbert<Hilbert<3, std::uint64_t>, std::uint64_t>(1 << 12));
+				
+				examiner << "The largest coordinates round trip." << std::endl;
+				Vector<3, std::uint32_t> corner = {(1 << 21) - 1, 5, (1 << 21) - 1};
+				examiner.check(Hilbert<3>::decode(Hilbert<3>::encode(corner)) == corner);
+				
+				Vector<2, std::uint32_t> edge = {0xFFFFFFFF, 0x12345678};
+				examiner.check(Hilbert<2>::decode(Hilbert<2>::encode(edge)) == edge);
+			}
+		},
+		
+		{"it can encode quantized positions",
+			[](UnitTest::Examiner & examiner) {
+				Morton<3, std::uint32_t>::QuantizationT quantization({-1, -1, -1}, {1, 1, 1});
+				
+				std::minstd_rand random(7);
+				std::uniform_real_distribution<float> uniform(-1.5, 1.5);
+				
+				std::vector<Vector<3, float>> positions(1003);
+				for (auto & position : positions)
+					position = {uniform(random), uniform(random), uniform(random)};
+				
+				std::vector<std::uint32_t> codes(positions.size()), hilbert(positions.size());
+				Morton<3, std::uint32_t>::encode(codes.data(), positions.data(), positions.size(), quantization);
+				Hilbert<3, std::uint32_t>::encode(hilbert.data(), positions.data(), positions.size(), quantization);
+				
+				bool matches = true;
+				for (std::size_t i = 0; i < positions.size(); i += 1) {
+					Vector<3, std::uint32_t> coordinate = quantization.encode(positions[i]);
+					
+					matches = matches && codes[i] == Morton<3, std::uint32_t>::encode(coordinate) && hilbert[i] == Hilbert<3, std::uint32_t>::encode(coordinate);
+				}
+				examiner.check(matches);
+				
+				examiner << "Positions outside the bounds are clamped." << std::endl;
+				Vector<3, float> outside[] = {{-2, -2, -2}, {2, 2, 2}, {0, 0, 0}, {-1, 1, -1}};
+				std::uint32_t clamped[4];
+				Morton<3, std::uint32_t>::encode(clamped, outside, 4, quantization);
+				
+				examiner.expect(clamped[0]) == 0;
+				examiner.expect(clamped[1]) == (1 << 30) - 1;
+				examiner.expect(clamped[3]) == Morton<3, std::uint32_t>::encode({0, 1023, 0});
+			}
+		},
+		
+		{"it can encode quantized positions with more bits than single precision",
+			[](UnitTest::Examiner & examiner) {
+				Morton<2, std::uint64_t>::QuantizationT quantization({-1, -1}, {1, 1});
+				
+				Vector<2, float> corners[] = {{-1, -1}, {1, 1}, {-1, 1}};
+				std::uint64_t morton[3], hilbert[3];
+				
+				Morton<2, std::uint64_t>::encode(morton, corners, 3, quantization);
+				Hilbert<2, std::uint64_t>::encode(hilbert, corners, 3, quantization);
+				
+				examiner.expect(morton[0]) == 0;
+				examiner.expect(morton[1]) == 0xFFFFFFFFFFFFFFFF;
+				examiner.expect(morton[2]) == 0xAAAAAAAAAAAAAAAA;
+				
+				Vector<2, std::uint32_t> maximum = {0xFFFFFFFF, 0xFFFFFFFF}, edge = {0, 0xFFFFFFFF};
+				examiner.expect(hilbert[0]) == 0;
+				examiner.check(Hilbert<2, std::uint64_t>::decode(hilbert[1]) == maximum);
+				examiner.check(Hilbert<2, std::uint64_t>::decode(hilbert[2]) == edge);
+			}
+		},
 	};
 }